@@ -587,6 +587,8 @@ APLRes APIOnInit(/*void*/)
     MenusOnNativeInit();
     GameModesOnNativeInit();
     CostumesOnNativeInit();
+    EdictsOnNativeInit();
+    VEffectsOnNativeInit();
     
     // Register natives
     APIOnNativeInit();
@@ -34,6 +34,7 @@ void CommandsOnInit(/*void*/)
     DebugOnCommandInit();
     ConfigOnCommandInit();
     LogOnCommandInit();
+    EdictsOnCommandInit();
     DeathOnCommandInit();
     SpawnOnCommandInit();
     MenusOnCommandInit();
@@ -43,5 +44,6 @@ void CommandsOnInit(/*void*/)
     GameModesOnCommandInit();
     ExtraItemsOnCommandInit();
     CostumesOnCommandInit();
+    VEffectsOnCommandInit();
     VersionOnCommandInit();
 }
\ No newline at end of file
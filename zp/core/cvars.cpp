@@ -88,6 +88,13 @@ enum CvarsList
     ConVar:CVAR_LOG_ERROR_OVERRIDE,
     ConVar:CVAR_LOG_PRINT_CHAT,
     
+    ConVar:CVAR_EDICTS_SPRITE,
+    ConVar:CVAR_EDICTS_ADDON,
+    ConVar:CVAR_EDICTS_PARTICLE,
+    ConVar:CVAR_EDICTS_COSTUME,
+    ConVar:CVAR_EDICTS_EFFECT,
+    ConVar:CVAR_EDICTS_REMOVE,
+    
     ConVar:CVAR_JUMPBOOST,
     ConVar:CVAR_JUMPBOOST_MULTIPLIER,
     ConVar:CVAR_JUMPBOOST_MAX,
@@ -157,6 +164,7 @@ enum CvarsList
     ConVar:CVAR_VEFFECTS_LEAP_NAME,
     ConVar:CVAR_VEFFECTS_LEAP_ATTACH,
     ConVar:CVAR_VEFFECTS_LEAP_DURATION,
+    ConVar:CVAR_VEFFECTS_PARTICLES_POOL,
     ConVar:CVAR_VEFFECTS_LIGHTSTYLE,
     ConVar:CVAR_VEFFECTS_LIGHTSTYLE_VALUE,
     ConVar:CVAR_VEFFECTS_SKY,
@@ -172,8 +180,11 @@ enum CvarsList
     ConVar:CVAR_VEFFECTS_RAGDOLL_REMOVE,
     ConVar:CVAR_VEFFECTS_RAGDOLL_DISSOLVE,
     ConVar:CVAR_VEFFECTS_RAGDOLL_DELAY,
+    ConVar:CVAR_VEFFECTS_RAGDOLL_TICK,
 
     ConVar:CVAR_SEFFECTS_LEVEL,
+    ConVar:CVAR_SEFFECTS_CULL,
+    ConVar:CVAR_SEFFECTS_CULL_PAS,
     ConVar:CVAR_SEFFECTS_ALLTALK,
     ConVar:CVAR_SEFFECTS_VOICE,
     ConVar:CVAR_SEFFECTS_VOICE_ZOMBIES_MUTE,
@@ -199,6 +210,7 @@ enum CvarsList
     ConVar:CVAR_MESSAGES_COUNTER,
     ConVar:CVAR_MESSAGES_BLAST,
     ConVar:CVAR_MESSAGES_DAMAGE,
+    ConVar:CVAR_MESSAGES_DAMAGE_DELAY,
     ConVar:CVAR_MESSAGES_DONATE,
     ConVar:CVAR_MESSAGES_CLASS_INFO,
     ConVar:CVAR_MESSAGES_CLASS_CHOOSE,
@@ -230,6 +242,7 @@ void CvarsOnInit(/*void*/)
     // Forward event to modules
     DataBaseOnCvarInit();
     LogOnCvarInit();
+    EdictsOnCvarInit();
     VEffectsOnCvarInit();
     SoundsOnCvarInit();
     ClassesOnCvarInit();
@@ -111,6 +111,11 @@ enum FactoryType
  **/
 char SteamID[MAXPLAYERS+1][STEAMID_MAX_LENGTH+1];
 
+/**
+ * @brief Size of the pending profile array. (Indexed by column type)
+ **/
+#define DATABASE_PROFILE_SIZE view_as<int>(ColumnType_All)
+
 /**
  * @brief Database module init function.
  **/
@@ -138,9 +143,19 @@ void DataBaseOnInit(/*void*/)
             // Close database
             delete gServerData.DataBase;
         }
+        
+        // Close pending profiles
+        delete gServerData.Profiles;
         return;
     }
 
+    // Validate pending profiles
+    if(gServerData.Profiles == null)
+    {
+        // Initialize a pending profiles map
+        gServerData.Profiles = new StringMap();
+    }
+
     // Connects to a database asynchronously, so the game thread is not blocked.
     Database.Connect(SQLBaseConnect_Callback, DATABASE_SECTION, (gCvarList[CVAR_DATABASE].IntValue == DatabaseType_Drop));
 
@@ -307,11 +322,14 @@ public void DataBaseOnCvarHook(ConVar hConVar, char[] oldValue, char[] newValue)
 }
 
 /**
- * @brief Client has been joined.
+ * @brief Client has been authorized.
  * 
+ * @note The profile is prefetched here and held in the pending cache
+ *       until the client is put in server.
+ *
  * @param clientIndex       The client index. 
  **/
-void DataBaseOnClientInit(int clientIndex)
+void DataBaseOnClientAuth(int clientIndex)
 {
     // If database doesn't exist, then stop
     if(gServerData.DataBase == null)
@@ -319,22 +337,58 @@ void DataBaseOnClientInit(int clientIndex)
         return;
     }
     
-    // Verify that the client is a real player
-    if(!IsFakeClient(clientIndex))
+    // If client was loaded, then stop
+    if(gClientData[clientIndex].Loaded || IsFakeClient(clientIndex))
+    {
+        return;
+    }
+
+    // Validate client authentication string (SteamID)
+    if(GetClientAuthId(clientIndex, AuthId_Steam2, SteamID[clientIndex], sizeof(SteamID[])))
     {
         // Initialize request char
         static char sRequest[HUGE_LINE_LENGTH]; 
 
-        // Validate client authentication string (SteamID)
-        if(GetClientAuthId(clientIndex, AuthId_Steam2, SteamID[clientIndex], sizeof(SteamID[])))
+        // Generate request
+        SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_All, FactoryType_Select, clientIndex);
+        
+        // Sent a request
+        gServerData.DataBase.Query(SQLBasePrefetch_Callback, sRequest, GetClientUserId(clientIndex), DBPrio_High);
+    }
+}
+
+/**
+ * @brief Client has been joined.
+ * 
+ * @param clientIndex       The client index. 
+ **/
+void DataBaseOnClientInit(int clientIndex)
+{
+    // If database doesn't exist, then stop
+    if(gServerData.DataBase == null)
+    {
+        return;
+    }
+    
+    // If client was loaded, then stop
+    if(gClientData[clientIndex].Loaded || IsFakeClient(clientIndex))
+    {
+        return;
+    }
+
+    // If client wasn't prefetched yet, then request it now
+    if(!hasLength(SteamID[clientIndex]))
+    {
+        // Validate authorization
+        if(IsClientAuthorized(clientIndex))
         {
-            // Generate request
-            SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_All, FactoryType_Select, clientIndex);
-            
-            // Sent a request
-            gServerData.DataBase.Query(SQLBaseSelect_Callback, sRequest, clientIndex, DBPrio_High);
+            DataBaseOnClientAuth(clientIndex);
         }
+        return;
     }
+    
+    // Apply the pending profile (if the request is still running, it will be applied in the callback)
+    DataBaseOnClientApply(clientIndex);
 }
 
 /**
@@ -358,6 +412,12 @@ void DataBaseOnClientDisconnectPost(int clientIndex)
     // Update data in the database
     DataBaseOnClientUpdate(clientIndex, ColumnType_All);
 
+    // Evict a stale pending profile
+    if(gServerData.Profiles != null && hasLength(SteamID[clientIndex]))
+    {
+        gServerData.Profiles.Remove(SteamID[clientIndex]);
+    }
+
     // Reset steam buffer
     SteamID[clientIndex][0] = '\0';
 }
@@ -392,6 +452,87 @@ void DataBaseOnClientUpdate(int clientIndex, ColumnType nColumn)
     gServerData.DataBase.Query(SQLBaseUpdate_Callback, sRequest, clientIndex, DBPrio_Low);
 }
 
+/**
+ * @brief Applies the pending profile to the client.
+ *
+ * @param clientIndex       The client index.
+ * @return                  True if the profile was applied, false if it wasn't fetched yet.
+ **/
+bool DataBaseOnClientApply(int clientIndex)
+{
+    // Initialize profile array
+    int iProfile[DATABASE_PROFILE_SIZE];
+
+    // Validate pending profile
+    if(gServerData.Profiles == null || !gServerData.Profiles.GetArray(SteamID[clientIndex], iProfile, sizeof(iProfile)))
+    {
+        return false;
+    }
+    
+    // Remove profile from the cache
+    gServerData.Profiles.Remove(SteamID[clientIndex]);
+    
+    // Client was found in the database
+    if(iProfile[view_as<int>(ColumnType_ID)] > 0)
+    {
+        // Sets client data
+        gClientData[clientIndex].DataID          = iProfile[view_as<int>(ColumnType_ID)];
+        gClientData[clientIndex].Money           = iProfile[view_as<int>(ColumnType_Money)];
+        gClientData[clientIndex].Level           = iProfile[view_as<int>(ColumnType_Level)];
+        gClientData[clientIndex].Exp             = iProfile[view_as<int>(ColumnType_Exp)];
+        gClientData[clientIndex].ZombieClassNext = iProfile[view_as<int>(ColumnType_Zombie)];
+        gClientData[clientIndex].HumanClassNext  = iProfile[view_as<int>(ColumnType_Human)];
+        gClientData[clientIndex].AutoRebuy       = view_as<bool>(iProfile[view_as<int>(ColumnType_Rebuy)]);
+        gClientData[clientIndex].Costume         = iProfile[view_as<int>(ColumnType_Costume)];
+        gClientData[clientIndex].Vision          = view_as<bool>(iProfile[view_as<int>(ColumnType_Vision)]);
+        gClientData[clientIndex].Time            = iProfile[view_as<int>(ColumnType_Time)];
+    }
+    else
+    {
+        // Initialize request char
+        static char sRequest[HUGE_LINE_LENGTH]; 
+
+        // Generate request
+        SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_SteamID, FactoryType_Insert, clientIndex);
+        
+        // Sent a request
+        gServerData.DataBase.Query(SQLBaseInsert_Callback, sRequest, clientIndex, DBPrio_High);    
+    }
+    
+    // Client was loaded
+    gClientData[clientIndex].Loaded = true;
+    return true;
+}
+
+/**
+ * @brief Extracts the profile from the result row.
+ *
+ * @param hResult           Handle to the child object.
+ * @param iProfile          The profile array output.
+ **/
+void DataBaseOnFetchProfile(DBResultSet hResult, int[] iProfile)
+{
+    // Client was found, get data from the row
+    if(hResult.FetchRow())
+    {
+        iProfile[view_as<int>(ColumnType_ID)]      = hResult.FetchInt(view_as<int>(ColumnType_ID)); 
+        iProfile[view_as<int>(ColumnType_Money)]   = hResult.FetchInt(view_as<int>(ColumnType_Money));
+        iProfile[view_as<int>(ColumnType_Level)]   = hResult.FetchInt(view_as<int>(ColumnType_Level));
+        iProfile[view_as<int>(ColumnType_Exp)]     = hResult.FetchInt(view_as<int>(ColumnType_Exp));              
+        iProfile[view_as<int>(ColumnType_Zombie)]  = hResult.FetchInt(view_as<int>(ColumnType_Zombie));
+        iProfile[view_as<int>(ColumnType_Human)]   = hResult.FetchInt(view_as<int>(ColumnType_Human));
+        iProfile[view_as<int>(ColumnType_Rebuy)]   = hResult.FetchInt(view_as<int>(ColumnType_Rebuy));
+        iProfile[view_as<int>(ColumnType_Costume)] = hResult.FetchInt(view_as<int>(ColumnType_Costume));
+        iProfile[view_as<int>(ColumnType_Vision)]  = hResult.FetchInt(view_as<int>(ColumnType_Vision));
+        iProfile[view_as<int>(ColumnType_Time)]    = hResult.FetchInt(view_as<int>(ColumnType_Time));
+    }
+    else
+    {
+        // Mark as a new player
+        iProfile[view_as<int>(ColumnType_ID)] = -1;
+    }
+}
+
 /*
  * Callbacks database API.
  */
@@ -618,35 +759,56 @@ public void SQLBaseSelect_Callback(Database hDatabase, DBResultSet hResult, char
         }
         else
         {
-            // Client was found, get data from the row
-            if(hResult.FetchRow())
-            {
-                // Sets client data
-                gClientData[clientIndex].DataID          = hResult.FetchInt(view_as<int>(ColumnType_ID)); 
-                gClientData[clientIndex].Money           = hResult.FetchInt(view_as<int>(ColumnType_Money));
-                gClientData[clientIndex].Level           = hResult.FetchInt(view_as<int>(ColumnType_Level));
-                gClientData[clientIndex].Exp             = hResult.FetchInt(view_as<int>(ColumnType_Exp));              
-                gClientData[clientIndex].ZombieClassNext = hResult.FetchInt(view_as<int>(ColumnType_Zombie));
-                gClientData[clientIndex].HumanClassNext  = hResult.FetchInt(view_as<int>(ColumnType_Human));
-                gClientData[clientIndex].AutoRebuy       = view_as<bool>(hResult.FetchInt(view_as<int>(ColumnType_Rebuy)));
-                gClientData[clientIndex].Costume         = hResult.FetchInt(view_as<int>(ColumnType_Costume));
-                gClientData[clientIndex].Vision          = view_as<bool>(hResult.FetchInt(view_as<int>(ColumnType_Vision)));
-                gClientData[clientIndex].Time            = hResult.FetchInt(view_as<int>(ColumnType_Time));
-            }
-            else
-            {
-                // Initialize request char
-                static char sRequest[HUGE_LINE_LENGTH]; 
+            // Initialize profile array
+            int iProfile[DATABASE_PROFILE_SIZE];
+            
+            // Extract profile and store it into the pending cache
+            DataBaseOnFetchProfile(hResult, iProfile);
+            gServerData.Profiles.SetArray(SteamID[clientIndex], iProfile, sizeof(iProfile));
+            
+            // Apply the profile
+            DataBaseOnClientApply(clientIndex);
+        }
+    }
+}
 
-                // Generate request
-                SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_SteamID, FactoryType_Insert, clientIndex);
-                
-                // Sent a request
-                gServerData.DataBase.Query(SQLBaseInsert_Callback, sRequest, clientIndex, DBPrio_High);    
-            }
+/**
+ * SQL: SELECT
+ * @brief Callback for receiving asynchronous database query results at client authorization.
+ *
+ * @param hDatabase         Parent object of the handle.
+ * @param hResult           Handle to the child object.
+ * @param sError            Error string if there was an error.
+ * @param userID            Data passed in via the original threaded invocation.
+ **/
+public void SQLBasePrefetch_Callback(Database hDatabase, DBResultSet hResult, char[] sError, int userID)
+{
+    // Gets client index from the user ID
+    int clientIndex = GetClientOfUserId(userID);
+
+    // Make sure the client didn't disconnect while the thread was running
+    if(clientIndex)
+    {
+        // If invalid query handle, then log error
+        if(hDatabase == null || hResult == null || hasLength(sError))
+        {
+            // Unexpected error, log it
+            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "%s", sError);
+        }
+        else
+        {
+            // Initialize profile array
+            int iProfile[DATABASE_PROFILE_SIZE];
             
-            // Client was loaded
-            gClientData[clientIndex].Loaded = true;
+            // Extract profile and store it into the pending cache
+            DataBaseOnFetchProfile(hResult, iProfile);
+            gServerData.Profiles.SetArray(SteamID[clientIndex], iProfile, sizeof(iProfile));
+
+            // If client is already in game, then apply the profile now
+            if(IsClientInGame(clientIndex))
+            {
+                DataBaseOnClientApply(clientIndex);
+            }
         }
     }
 }
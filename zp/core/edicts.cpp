@@ -0,0 +1,765 @@
+/**
+ * ============================================================================
+ *
+ *  Zombie Plague
+ *
+ *  File:          edicts.cpp
+ *  Type:          Core
+ *  Description:   Budget of the edicts used by the cosmetic entities, the removal queue and the entity templates.
+ *
+ *  Copyright (C) 2015-2019 Nikita Ushakov (Ireland, Dublin)
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ============================================================================
+ **/
+
+/**
+ * @section Number of valid edicts.
+ **/
+#define EDICTS_ENTITY_MAX 2048
+#define EDICTS_TYPE_MAX 5
+/**
+ * @endsection
+ **/
+
+/**
+ * @section Types of the budget entities. (Lowest priority goes first)
+ **/
+enum EdictType
+{
+    EdictType_Sprite,             /**  Health sprites */
+    EdictType_Addon,              /**  Weapon back attachments */
+    EdictType_Particle,           /**  Particle effects */
+    EdictType_Costume,            /**  Hats and costumes */
+    EdictType_Effect              /**  Any other effects (dissolvers, etc.) */
+};
+/**
+ * @endsection
+ **/
+
+/**
+ * @section Removal queue data indexes.
+ **/
+enum
+{
+    EDICTS_REMOVE_REFERENCE,
+    EDICTS_REMOVE_TIME,
+    EDICTS_REMOVE_MAX
+};
+/**
+ * @endsection
+ **/
+ 
+/**
+ * @section Entity template data indexes.
+ **/
+enum
+{
+    EDICTS_TEMPLATE_NAME,
+    EDICTS_TEMPLATE_CLASSNAME,
+    EDICTS_TEMPLATE_VALID,    /* The classname was created at least once */
+    EDICTS_TEMPLATE_INPUTS,   /* Amount of the inputs, followed by the inputs and then the key/value pairs */
+    EDICTS_TEMPLATE_DATA
+};
+/**
+ * @endsection
+ **/
+
+/**
+ * @section Arrays to store the tracked entities.
+ **/
+int EdictsType[EDICTS_ENTITY_MAX]; /* Type + 1 of the tracked entity, 0 if untracked */
+int EdictsCount[EDICTS_TYPE_MAX];
+int EdictsRefused[EDICTS_TYPE_MAX];
+/**
+ * @endsection
+ **/
+
+/**
+ * @brief Hook edicts cvar changes.
+ **/
+void EdictsOnCvarInit(/*void*/)
+{
+    // Create cvars
+    gCvarList[CVAR_EDICTS_SPRITE]   = FindConVar("zp_edicts_sprite");
+    gCvarList[CVAR_EDICTS_ADDON]    = FindConVar("zp_edicts_addon");
+    gCvarList[CVAR_EDICTS_PARTICLE] = FindConVar("zp_edicts_particle");
+    gCvarList[CVAR_EDICTS_COSTUME]  = FindConVar("zp_edicts_costume");
+    gCvarList[CVAR_EDICTS_EFFECT]   = FindConVar("zp_edicts_effect");
+    gCvarList[CVAR_EDICTS_REMOVE]   = FindConVar("zp_edicts_remove");
+}
+
+/**
+ * @brief Creates commands for edicts module.
+ **/
+void EdictsOnCommandInit(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_edicts_stats", EdictsOnCommandCatched, ADMFLAG_GENERIC, "Prints the edict budget statistics.");
+}
+
+/**
+ * Console command callback (zp_edicts_stats)
+ * @brief Prints the edict budget statistics.
+ *
+ * @param clientIndex       The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/
+public Action EdictsOnCommandCatched(int clientIndex, int iArguments)
+{
+    // Initialize names
+    static char sType[EDICTS_TYPE_MAX][SMALL_LINE_LENGTH] = { "sprite", "addon", "particle", "costume", "effect" };
+
+    // Print the global amount
+    ReplyToCommand(clientIndex, "Edicts: %d in use | %d queued for removal | %d templates", GetEntityCount(), gServerData.Removals.Length, gServerData.Templates.Length);
+
+    // i = type index
+    for(int i = 0; i < EDICTS_TYPE_MAX; i++)
+    {
+        // Print the type statistics
+        ReplyToCommand(clientIndex, "  %-10s tracked: %4d | limit: %4d | refused: %d", sType[i], EdictsCount[i], EdictsGetLimit(view_as<EdictType>(i)), EdictsRefused[i]);
+    }
+
+    return Plugin_Handled;
+}
+
+/**
+ * @brief Edicts module purge function.
+ **/
+void EdictsOnPurge(/*void*/)
+{
+    // The map entities are removed by the engine
+    gServerData.Removals.Clear();
+}
+
+/**
+ * @brief Called before every server frame.
+ **/
+void EdictsOnGameFrame(/*void*/)
+{
+    // Validate any queued entity
+    int iSize = gServerData.Removals.Length;
+    if(!iSize)
+    {
+        return;
+    }
+    
+    // Gets current time
+    float flTime = GetGameTime();
+    
+    // Gets the amount of removals per frame
+    int iLimit = gCvarList[CVAR_EDICTS_REMOVE].IntValue; int iCount;
+    
+    // i = queue index (the nearest removal is at the end)
+    for(int i = iSize - 1; i >= 0; i--)
+    {
+        // Validate due time
+        if(view_as<float>(gServerData.Removals.Get(i, EDICTS_REMOVE_TIME)) > flTime)
+        {
+            break;
+        }
+        
+        // Validate limit
+        if(iLimit && iCount >= iLimit)
+        {
+            break;
+        }
+        
+        // Validate entity (index can be reused)
+        int entityIndex = EntRefToEntIndex(gServerData.Removals.Get(i, EDICTS_REMOVE_REFERENCE));
+        if(entityIndex != INVALID_ENT_REFERENCE)
+        {
+            // Kill the entity
+            AcceptEntityInput(entityIndex, "Kill");
+            iCount++;
+        }
+        
+        // Remove from the queue
+        gServerData.Removals.Erase(i);
+    }
+}
+
+/**
+ * @brief Called when an entity is destroyed.
+ *
+ * @param entityIndex       The entity index.
+ **/
+void EdictsOnEntityDestroyed(int entityIndex)
+{
+    // Validate index
+    if(entityIndex <= MaxClients || entityIndex >= EDICTS_ENTITY_MAX)
+    {
+        return;
+    }
+
+    // Validate tracked entity
+    int iType = EdictsType[entityIndex];
+    if(iType)
+    {
+        // Release the budget
+        EdictsCount[iType - 1]--;
+        EdictsType[entityIndex] = 0;
+    }
+}
+
+/*
+ * Edicts natives API.
+ */
+
+/**
+ * @brief Sets up natives for library.
+ **/
+void EdictsOnNativeInit(/*void*/)
+{
+    CreateNative("ZP_RequestEdictBudget", API_RequestEdictBudget);
+    CreateNative("ZP_TrackEdictBudget",   API_TrackEdictBudget);
+    CreateNative("ZP_RemoveEntity",       API_RemoveEntity);
+    CreateNative("ZP_CreateEntityTemplate",   API_CreateEntityTemplate);
+    CreateNative("ZP_AddEntityTemplateInput", API_AddEntityTemplateInput);
+    CreateNative("ZP_SpawnEntityTemplate",    API_SpawnEntityTemplate);
+    
+    // Initialize a removal queue
+    gServerData.Removals = new ArrayList(EDICTS_REMOVE_MAX);
+    
+    // Initialize a template list
+    gServerData.Templates = new ArrayList();
+}
+
+/**
+ * @brief Validates that an entity of the given type can be created.
+ *
+ * @note native bool ZP_RequestEdictBudget(type);
+ **/
+public int API_RequestEdictBudget(Handle hPlugin, int iNumParams)
+{
+    // Gets type from native cell
+    EdictType nType = GetNativeCell(1);
+
+    // Validate type
+    if(nType < EdictType_Sprite || nType > EdictType_Effect)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Invalid the edict type (%d)", nType);
+        return false;
+    }
+
+    // Return the value
+    return EdictsRequest(nType);
+}
+
+/**
+ * @brief Counts the entity in the budget of the given type.
+ *
+ * @note native void ZP_TrackEdictBudget(entityIndex, type);
+ **/
+public int API_TrackEdictBudget(Handle hPlugin, int iNumParams)
+{
+    // Gets entity index from native cell
+    int entityIndex = GetNativeCell(1);
+
+    // Validate entity
+    if(!IsValidEdict(entityIndex))
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Invalid the entity index (%d)", entityIndex);
+        return -1;
+    }
+
+    // Gets type from native cell
+    EdictType nType = GetNativeCell(2);
+
+    // Validate type
+    if(nType < EdictType_Sprite || nType > EdictType_Effect)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Invalid the edict type (%d)", nType);
+        return -1;
+    }
+
+    // Track the entity
+    EdictsTrack(entityIndex, nType);
+    return entityIndex;
+}
+
+/**
+ * @brief Removes the entity from a world after some delay.
+ *
+ * @note native void ZP_RemoveEntity(entityIndex, delay);
+ **/
+public int API_RemoveEntity(Handle hPlugin, int iNumParams)
+{
+    // Gets entity index from native cell
+    int entityIndex = GetNativeCell(1);
+
+    // Validate entity
+    if(entityIndex <= MaxClients || !IsValidEdict(entityIndex))
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Invalid the entity index (%d)", entityIndex);
+        return -1;
+    }
+    
+    // Push entity into the queue
+    EdictsRemoveEntity(entityIndex, GetNativeCell(2));
+    return entityIndex;
+}
+
+/**
+ * @brief Creates or updates the named entity template.
+ *
+ * @note native int ZP_CreateEntityTemplate(name, classname, ...);
+ **/
+public int API_CreateEntityTemplate(Handle hPlugin, int iNumParams)
+{
+    // Initialize name and classname char
+    static char sName[SMALL_LINE_LENGTH]; static char sClassname[SMALL_LINE_LENGTH];
+    GetNativeString(1, sName, sizeof(sName));
+    GetNativeString(2, sClassname, sizeof(sClassname));
+    
+    // Validate name
+    if(!hasLength(sName) || !hasLength(sClassname))
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Can't create a template with an empty name or classname");
+        return -1;
+    }
+    
+    // Validate key/value pairs
+    if(iNumParams % 2)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Invalid the key/value pairs of the template \"%s\"", sName);
+        return -1;
+    }
+    
+    // Initialize key/value char
+    static char sKey[SMALL_LINE_LENGTH]; static char sValue[PLATFORM_LINE_LENGTH];
+    
+    // Initialize the template data
+    ArrayList hTemplate = new ArrayList(ByteCountToCells(PLATFORM_LINE_LENGTH));
+    hTemplate.PushString(sName);
+    hTemplate.PushString(sClassname);
+    hTemplate.Push(false);
+    hTemplate.Push(0);
+    
+    // i = key index
+    for(int i = 3; i < iNumParams; i += 2)
+    {
+        // Gets the key/value pair
+        GetNativeString(i, sKey, sizeof(sKey));
+        GetNativeString(i + 1, sValue, sizeof(sValue));
+        
+        // Validate key
+        if(!hasLength(sKey))
+        {
+            LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Empty key of the template \"%s\"", sName);
+            delete hTemplate;
+            return -1;
+        }
+        
+        // Push data into array
+        hTemplate.PushString(sKey);
+        hTemplate.PushString(sValue);
+    }
+    
+    // Validate the existing template (reloaded plugin)
+    int iD = EdictsTemplateNameToIndex(sName);
+    if(iD != -1)
+    {
+        // Replace the template data
+        delete view_as<ArrayList>(gServerData.Templates.Get(iD));
+        gServerData.Templates.Set(iD, hTemplate);
+        return iD;
+    }
+    
+    // Return on success
+    return gServerData.Templates.Push(hTemplate);
+}
+
+/**
+ * @brief Adds the input which is fired on the spawn of the template entity.
+ *
+ * @note native void ZP_AddEntityTemplateInput(templateID, input);
+ **/
+public int API_AddEntityTemplateInput(Handle hPlugin, int iNumParams)
+{
+    // Gets template index from native cell
+    int iD = GetNativeCell(1);
+    
+    // Validate index
+    if(iD < 0 || iD >= gServerData.Templates.Length)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Invalid the template index (%d)", iD);
+        return -1;
+    }
+    
+    // Initialize input char
+    static char sInput[SMALL_LINE_LENGTH];
+    GetNativeString(2, sInput, sizeof(sInput));
+    
+    // Validate input
+    if(!hasLength(sInput))
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Can't add an empty input to the template (%d)", iD);
+        return -1;
+    }
+    
+    // Gets the template data
+    ArrayList hTemplate = gServerData.Templates.Get(iD);
+    
+    // Insert the input after the existing ones
+    int iCount = hTemplate.Get(EDICTS_TEMPLATE_INPUTS);
+    int iIndex = EDICTS_TEMPLATE_DATA + iCount;
+    if(iIndex == hTemplate.Length)
+    {
+        hTemplate.PushString(sInput);
+    }
+    else
+    {
+        hTemplate.ShiftUp(iIndex);
+        hTemplate.SetString(iIndex, sInput);
+    }
+    hTemplate.Set(EDICTS_TEMPLATE_INPUTS, iCount + 1);
+    return iD;
+}
+
+/**
+ * @brief Spawns the entity from the template.
+ *
+ * @note native int ZP_SpawnEntityTemplate(templateID, origin, angles, parentIndex, attach, duration, ...);
+ **/
+public int API_SpawnEntityTemplate(Handle hPlugin, int iNumParams)
+{
+    // Gets template index from native cell
+    int iD = GetNativeCell(1);
+    
+    // Validate index
+    if(iD < 0 || iD >= gServerData.Templates.Length)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Invalid the template index (%d)", iD);
+        return -1;
+    }
+    
+    // Gets parent index from native cell
+    int parentIndex = GetNativeCell(4);
+    
+    // Validate parent
+    if(parentIndex != -1 && !IsValidEdict(parentIndex))
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Invalid the parent index (%d)", parentIndex);
+        return -1;
+    }
+    
+    // Validate overrides
+    if(iNumParams % 2)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Invalid the key/value overrides of the template (%d)", iD);
+        return -1;
+    }
+    
+    // Create an entity
+    int entityIndex = EdictsTemplateCreate(iD);
+    
+    // Validate entity
+    if(entityIndex == INVALID_ENT_REFERENCE)
+    {
+        return -1;
+    }
+    
+    // Initialize vector variables
+    static float vPosition[3]; static float vAngle[3];
+    
+    // Validate origin
+    if(!IsNativeParamNullVector(2))
+    {
+        GetNativeArray(2, vPosition, sizeof(vPosition));
+        DispatchKeyValueVector(entityIndex, "origin", vPosition);
+    }
+    
+    // Validate angles
+    if(!IsNativeParamNullVector(3))
+    {
+        GetNativeArray(3, vAngle, sizeof(vAngle));
+        DispatchKeyValueVector(entityIndex, "angles", vAngle);
+    }
+    
+    // Initialize key/value char
+    static char sKey[SMALL_LINE_LENGTH]; static char sValue[PLATFORM_LINE_LENGTH];
+    
+    // i = key index
+    for(int i = 7; i < iNumParams; i += 2)
+    {
+        // Dispatch the override of the template value
+        GetNativeString(i, sKey, sizeof(sKey));
+        GetNativeString(i + 1, sValue, sizeof(sValue));
+        DispatchKeyValue(entityIndex, sKey, sValue);
+    }
+    
+    // Initialize attachment char
+    static char sAttach[SMALL_LINE_LENGTH];
+    GetNativeString(5, sAttach, sizeof(sAttach));
+    
+    // Spawn the entity
+    EdictsTemplateSpawn(entityIndex, iD, parentIndex, sAttach, GetNativeCell(6));
+    return entityIndex;
+}
+
+/*
+ * Stocks edicts API.
+ */
+
+/**
+ * @brief Gets the edict limit for the given type.
+ *
+ * @param nType             The type of the entity.
+ * @return                  The amount of edicts, after which the type is refused.
+ **/
+int EdictsGetLimit(EdictType nType)
+{
+    switch(nType)
+    {
+        case EdictType_Sprite   : return gCvarList[CVAR_EDICTS_SPRITE].IntValue;
+        case EdictType_Addon    : return gCvarList[CVAR_EDICTS_ADDON].IntValue;
+        case EdictType_Particle : return gCvarList[CVAR_EDICTS_PARTICLE].IntValue;
+        case EdictType_Costume  : return gCvarList[CVAR_EDICTS_COSTUME].IntValue;
+    }
+
+    return gCvarList[CVAR_EDICTS_EFFECT].IntValue;
+}
+
+/**
+ * @brief Validates that an entity of the given type can be created.
+ *
+ * @note The types have a progressive limits, so the low priority
+ *       cosmetics are refused first, when the server gets close to the edict limit.
+ *
+ * @param nType             The type of the entity.
+ * @return                  True if the entity can be created, false otherwise.
+ **/
+bool EdictsRequest(EdictType nType)
+{
+    // Gets the limit of the type
+    int iLimit = EdictsGetLimit(nType);
+
+    // Validate budget
+    if(iLimit && GetEntityCount() >= iLimit)
+    {
+        EdictsRefused[view_as<int>(nType)]++;
+        return false;
+    }
+
+    // Return on success
+    return true;
+}
+
+/**
+ * @brief Counts the entity in the budget of the given type.
+ *
+ * @param entityIndex       The entity index.
+ * @param nType             The type of the entity.
+ **/
+void EdictsTrack(int entityIndex, EdictType nType)
+{
+    // Validate index
+    if(entityIndex <= MaxClients || entityIndex >= EDICTS_ENTITY_MAX)
+    {
+        return;
+    }
+
+    // Release the previous budget
+    EdictsOnEntityDestroyed(entityIndex);
+
+    // Store the type
+    EdictsType[entityIndex] = view_as<int>(nType) + 1;
+    EdictsCount[view_as<int>(nType)]++;
+}
+
+/**
+ * @brief Removes the entity from a world after some delay.
+ *
+ * @note The queue is sorted by the due time in descending order,
+ *       so the frame processing only pops from the end.
+ *
+ * @param entityIndex       The entity index.
+ * @param flDelayTime       The number of seconds to kill an entity.
+ **/
+void EdictsRemoveEntity(int entityIndex, float flDelayTime)
+{
+    // Gets the due time
+    float flTime = GetGameTime() + flDelayTime;
+    
+    // Find the position with a binary search
+    int iLow = 0; int iHigh = gServerData.Removals.Length;
+    while(iLow < iHigh)
+    {
+        int iMiddle = (iLow + iHigh) / 2;
+        if(view_as<float>(gServerData.Removals.Get(iMiddle, EDICTS_REMOVE_TIME)) > flTime)
+        {
+            iLow = iMiddle + 1;
+        }
+        else
+        {
+            iHigh = iMiddle;
+        }
+    }
+    
+    // Insert the entity
+    if(iLow == gServerData.Removals.Length)
+    {
+        iLow = gServerData.Removals.Push(EntIndexToEntRef(entityIndex));
+    }
+    else
+    {
+        gServerData.Removals.ShiftUp(iLow);
+        gServerData.Removals.Set(iLow, EntIndexToEntRef(entityIndex), EDICTS_REMOVE_REFERENCE);
+    }
+    gServerData.Removals.Set(iLow, flTime, EDICTS_REMOVE_TIME);
+}
+
+/**
+ * @brief Find the index at which the template name is at.
+ * 
+ * @param sName             The template name.
+ * @return                  The array index containing the given template name.
+ **/
+int EdictsTemplateNameToIndex(const char[] sName)
+{
+    // Initialize name char
+    static char sTemplateName[SMALL_LINE_LENGTH];
+    
+    // i = template index
+    int iSize = gServerData.Templates.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Gets template name 
+        ArrayList hTemplate = gServerData.Templates.Get(i);
+        hTemplate.GetString(EDICTS_TEMPLATE_NAME, sTemplateName, sizeof(sTemplateName));
+        
+        // If names match, then return index
+        if(!strcmp(sName, sTemplateName, false))
+        {
+            return i;
+        }
+    }
+    
+    // Return on unsuccess
+    return -1;
+}
+
+/**
+ * @brief Creates the entity with the template key/values, but doesn't spawn it.
+ *
+ * @note The classname is validated on the first creation,
+ *       because the entities can't be created before the map is loaded.
+ * 
+ * @param iD                The template index.
+ * @return                  The entity index.
+ **/
+int EdictsTemplateCreate(int iD)
+{
+    // Validate budget
+    if(!EdictsRequest(EdictType_Effect))
+    {
+        return INVALID_ENT_REFERENCE;
+    }
+    
+    // Initialize key/value char
+    static char sKey[SMALL_LINE_LENGTH]; static char sValue[PLATFORM_LINE_LENGTH];
+    
+    // Gets the template data
+    ArrayList hTemplate = gServerData.Templates.Get(iD);
+    hTemplate.GetString(EDICTS_TEMPLATE_CLASSNAME, sValue, sizeof(sValue));
+    
+    // Create an entity
+    int entityIndex = CreateEntityByName(sValue);
+    
+    // Validate entity
+    if(entityIndex == INVALID_ENT_REFERENCE)
+    {
+        // Validate the first creation
+        if(!hTemplate.Get(EDICTS_TEMPLATE_VALID))
+        {
+            // Gets the template name
+            static char sName[SMALL_LINE_LENGTH];
+            hTemplate.GetString(EDICTS_TEMPLATE_NAME, sName, sizeof(sName));
+            LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Invalid the classname \"%s\" of the template \"%s\"", sValue, sName);
+        }
+    }
+    else
+    {
+        // Sets the classname as valid
+        hTemplate.Set(EDICTS_TEMPLATE_VALID, true);
+        
+        // i = key index
+        int iSize = hTemplate.Length;
+        for(int i = EDICTS_TEMPLATE_DATA + hTemplate.Get(EDICTS_TEMPLATE_INPUTS); i < iSize; i += 2)
+        {
+            // Dispatch the template value
+            hTemplate.GetString(i, sKey, sizeof(sKey));
+            hTemplate.GetString(i + 1, sValue, sizeof(sValue));
+            DispatchKeyValue(entityIndex, sKey, sValue);
+        }
+    }
+    
+    // Return on the success
+    return entityIndex;
+}
+
+/**
+ * @brief Spawns the template entity, fires the template inputs and sets its parent.
+ * 
+ * @param entityIndex       The entity index.
+ * @param iD                The template index.
+ * @param parentIndex       The parent index or -1 for the world entity.
+ * @param sAttach           The attachment name.
+ * @param flDurationTime    The duration of the entity.
+ **/
+void EdictsTemplateSpawn(int entityIndex, int iD, int parentIndex, const char[] sAttach, float flDurationTime)
+{
+    // Initialize input char
+    static char sInput[SMALL_LINE_LENGTH];
+    
+    // Spawn the entity into the world
+    DispatchSpawn(entityIndex);
+    ActivateEntity(entityIndex);
+    EdictsTrack(entityIndex, EdictType_Effect);
+    
+    // i = input index
+    ArrayList hTemplate = gServerData.Templates.Get(iD);
+    int iCount = hTemplate.Get(EDICTS_TEMPLATE_INPUTS);
+    for(int i = 0; i < iCount; i++)
+    {
+        // Activate the entity
+        hTemplate.GetString(EDICTS_TEMPLATE_DATA + i, sInput, sizeof(sInput));
+        AcceptEntityInput(entityIndex, sInput);
+    }
+    
+    // Validate parent
+    if(parentIndex != -1)
+    {
+        // Sets parent to the entity
+        SetVariantString("!activator");
+        AcceptEntityInput(entityIndex, "SetParent", parentIndex, entityIndex);
+        ToolsSetEntityOwner(entityIndex, parentIndex);
+        
+        // Sets attachment to the entity
+        if(hasLength(sAttach))
+        { 
+            SetVariantString(sAttach); 
+            AcceptEntityInput(entityIndex, "SetParentAttachment", parentIndex, entityIndex);
+        }
+    }
+    
+    // Validate duration
+    if(flDurationTime > 0.0)
+    {
+        // Kill entity after delay
+        EdictsRemoveEntity(entityIndex, flDurationTime);
+    }
+}
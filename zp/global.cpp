@@ -127,12 +127,21 @@ enum struct ServerData
     bool MapLoaded;
     ArrayList Spawns;
     ArrayList Particles;
+    ArrayList ParticlePool;
+    StringMap ParticleIndexes;
+    StringMap EffectIndexes;
+    ArrayList Ragdolls;
+    ArrayList Removals;
+    ArrayList Templates;
     
     /* OS */
     EngineOS Platform;
     
     /* Timer */
     Handle CounterTimer;
+    Handle SpriteTimer;
+    Handle RagdollTimer;
+    Handle AudioTimer;
     
     /// Sounds 
     Handle EndTimer; 
@@ -146,6 +155,16 @@ enum struct ServerData
     
     /* Database */
     Database DataBase;
+    StringMap Profiles;
+    
+    /* Hooks */
+    ArrayList DamageHooks;
+    ArrayList SkillHooks;
+    ArrayList ItemHooks;
+    ArrayList SoundHooks;
+    
+    /* Menus */
+    StringMap MenuCache;
     
     /* Synchronizers */
     Handle LevelSync;
@@ -166,6 +185,8 @@ enum struct ServerData
     ArrayList Weapons;
     ArrayList Downloads;
     ArrayList Sounds;
+    StringMap SoundKeys;
+    ArrayList SoundDistances;
     ArrayList Levels;
     
     /**
@@ -174,6 +195,9 @@ enum struct ServerData
     void PurgeTimers(/*void*/)
     {
         this.CounterTimer = null;
+        this.SpriteTimer  = null;
+        this.RagdollTimer = null;
+        this.AudioTimer   = null;
         this.EndTimer     = null;
         this.BlastTimer   = null;
     }
@@ -212,7 +236,13 @@ enum struct ClientData
     bool Vision;
     int Time;
     int LastAttacker;
+    int RewardDamage;
+    int HintVictim;
+    int HintDamage;
+    int HintHealth;
     float HealthDuration;
+    float AmbientTime;
+    float MoanTime;
     int AttachmentCostume;
     int AttachmentHealth;
     int AttachmentController;
@@ -237,15 +267,13 @@ enum struct ClientData
     Handle BarTimer;
     Handle CounterTimer;
     Handle HealTimer;
-    Handle SpriteTimer;
-    Handle MoanTimer;
-    Handle AmbientTimer;
     Handle BuyTimer;
+    Handle HintTimer;
     
     /* Arrays */
     ArrayList ShoppingCart;
-    StringMap ItemLimit;
-    StringMap WeaponLimit;
+    StringMap ItemLimit;   /* Overflow of the item purchase ledger */
+    StringMap WeaponLimit; /* Overflow of the weapon purchase ledger */
     
     /**
      * @brief Resets all variables.
@@ -271,6 +299,10 @@ enum struct ClientData
         this.Vision               = true;
         this.Time                 = 0;
         this.LastAttacker         = 0;
+        this.RewardDamage         = 0;
+        this.HintVictim           = 0;
+        this.HintDamage           = 0;
+        this.HintHealth           = 0;
         this.HealthDuration       = 0.0;
         this.AttachmentCostume    = INVALID_ENT_REFERENCE;
         this.AttachmentHealth     = INVALID_ENT_REFERENCE;
@@ -314,10 +346,16 @@ enum struct ClientData
         delete this.BarTimer;
         delete this.CounterTimer;
         delete this.HealTimer;
-        delete this.SpriteTimer;
-        delete this.MoanTimer;
-        delete this.AmbientTimer;
         delete this.BuyTimer;
+        delete this.HintTimer;
+        
+        // Clear the pending damage hint
+        this.HintVictim = 0;
+        this.HintDamage = 0;
+        
+        // Clear the schedule of the shared audio tick
+        this.AmbientTime = 0.0;
+        this.MoanTime    = 0.0;
     }
     
     /**
@@ -332,10 +370,12 @@ enum struct ClientData
         this.BarTimer       = null;
         this.CounterTimer   = null;
         this.HealTimer      = null;
-        this.SpriteTimer    = null;
-        this.MoanTimer      = null; 
-        this.AmbientTimer   = null; 
         this.BuyTimer       = null;
+        this.HintTimer      = null;
+        this.HintVictim     = 0;
+        this.HintDamage     = 0;
+        this.AmbientTime    = 0.0;
+        this.MoanTime       = 0.0;
     }
 }
 /**
@@ -366,4 +406,25 @@ public void OnEntityCreated(int entityIndex, const char[] sClassname)
 {
     // Forward event to modules
     WeaponOnEntityCreated(entityIndex, sClassname);
+}
+
+/**
+ * @brief Called before every server frame.
+ **/
+public void OnGameFrame(/*void*/)
+{
+    // Forward event to modules
+    EdictsOnGameFrame();
+}
+
+/**
+ * @brief Called when an entity is destroyed.
+ *
+ * @param entityIndex       The entity index.
+ **/
+public void OnEntityDestroyed(int entityIndex)
+{
+    // Forward event to modules
+    EdictsOnEntityDestroyed(entityIndex);
+    ToolsOnEntityDestroyed(entityIndex);
 }
\ No newline at end of file
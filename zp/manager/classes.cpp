@@ -196,6 +196,9 @@ void ClassesOnLoad(/*void*/)
  **/
 void ClassesOnCacheData(/*void*/)
 {
+    // Remove cached menu lines (indexes can be changed)
+    MenusClearCache();
+    
     // Gets config file path
     static char sPathClasses[PLATFORM_LINE_LENGTH];
     ConfigGetConfigPath(File_Classes, sPathClasses, sizeof(sPathClasses));
@@ -320,6 +320,17 @@ void CostumesOnClientInit(int clientIndex)
  * @param clientIndex       The client index.
  **/
 void CostumesOnClientDeath(int clientIndex)
+{
+    // Hide current costume
+    CostumesHide(clientIndex);
+}
+
+/**
+ * @brief Client has been disconnected.
+ * 
+ * @param clientIndex       The client index.
+ **/
+void CostumesOnClientDisconnectPost(int clientIndex)
 {
     // Remove current costume
     CostumesRemove(clientIndex);
@@ -1135,6 +1146,8 @@ public MRESReturn CostumesDhookOnSetEntityModel(int clientIndex)
 /**
  * @brief Creates an attachment costume entity for the client.
  *
+ * @note The entity is created once and reused on each update of the costume.
+ *
  * @param clientIndex       The client index.
  **/
 void CostumesCreateEntity(int clientIndex)
@@ -1142,12 +1155,11 @@ void CostumesCreateEntity(int clientIndex)
     // Validate client
     if(IsPlayerExist(clientIndex))
     {
-        // Remove current costume
-        CostumesRemove(clientIndex);
-
         // Validate zombie
         if(gClientData[clientIndex].Zombie)
         {
+            // Hide current costume
+            CostumesHide(clientIndex);
             return;
         }
         
@@ -1157,6 +1169,8 @@ void CostumesCreateEntity(int clientIndex)
         // Validate costume
         if(gClientData[clientIndex].Costume == -1 || iSize <= gClientData[clientIndex].Costume)
         {
+            // Remove current costume
+            CostumesRemove(clientIndex);
             gClientData[clientIndex].Costume = -1;
             return;
         }
@@ -1168,6 +1182,8 @@ void CostumesCreateEntity(int clientIndex)
         // Validate access
         if(hasLength(sGroup) && !IsPlayerInGroup(clientIndex, sGroup))
         {
+            // Remove current costume
+            CostumesRemove(clientIndex);
             gClientData[clientIndex].Costume = -1;
             return;
         }
@@ -1176,8 +1192,25 @@ void CostumesCreateEntity(int clientIndex)
         static char sModel[PLATFORM_LINE_LENGTH];
         CostumesGetModel(gClientData[clientIndex].Costume, sModel, sizeof(sModel));
         
-        // Creates an attach addon entity 
-        int entityIndex = UTIL_CreateDynamic(NULL_VECTOR, NULL_VECTOR, sModel);
+        // Gets current costume from the client reference
+        int entityIndex = EntRefToEntIndex(gClientData[clientIndex].AttachmentCostume);
+        
+        // Validate costume
+        if(entityIndex != INVALID_ENT_REFERENCE)
+        {
+            // Detach the entity and sets the new model
+            AcceptEntityInput(entityIndex, "ClearParent");
+            SetEntityModel(entityIndex, sModel);
+            
+            // Remove merging and visibility effects
+            ToolsSetEntityEffect(entityIndex, ToolsGetEntityEffect(entityIndex) & ~(EF_NODRAW | EF_BONEMERGE | EF_BONEMERGE_FASTCULL));
+        }
+        else if(EdictsRequest(EdictType_Costume))
+        {
+            // Creates an attach addon entity 
+            entityIndex = UTIL_CreateDynamic(NULL_VECTOR, NULL_VECTOR, sModel);
+            EdictsTrack(entityIndex, EdictType_Costume);
+        }
         
         // If entity isn't valid, then skip
         if(entityIndex != INVALID_ENT_REFERENCE)
@@ -1241,8 +1274,8 @@ void CostumesCreateEntity(int clientIndex)
             // Validate merging
             if(CostumesIsMerge(gClientData[clientIndex].Costume)) CostumesBoneMerge(entityIndex);
 
-            // Hook entity callbacks
-            if(CostumesIsHide(gClientData[clientIndex].Costume)) SDKHook(entityIndex, SDKHook_SetTransmit, ToolsOnEntityTransmit);
+            // Sets transmit rule of the entity
+            ToolsSetEntityTransmit(entityIndex, CostumesIsHide(gClientData[clientIndex].Costume) ? TransmitType_HideOwner : TransmitType_Always);
             
             // Store the client cache
             gClientData[clientIndex].AttachmentCostume = EntIndexToEntRef(entityIndex);
@@ -1284,4 +1317,27 @@ void CostumesRemove(int clientIndex)
     {
         AcceptEntityInput(entityIndex, "Kill"); /// Destroy
     }
+    
+    // Clear the client cache
+    gClientData[clientIndex].AttachmentCostume = INVALID_ENT_REFERENCE;
+}
+
+/**
+ * @brief Hide a costume entities of the client.
+ *
+ * @note The entity is kept to be reused on the next update.
+ *
+ * @param clientIndex       The client index.
+ **/
+void CostumesHide(int clientIndex)
+{
+    // Gets current costume from the client reference
+    int entityIndex = EntRefToEntIndex(gClientData[clientIndex].AttachmentCostume);
+
+    // Validate costume
+    if(entityIndex != INVALID_ENT_REFERENCE) 
+    {
+        // Sets no draw effect
+        ToolsSetEntityEffect(entityIndex, ToolsGetEntityEffect(entityIndex) | EF_NODRAW);
+    }
 }
\ No newline at end of file
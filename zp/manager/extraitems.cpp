@@ -25,6 +25,21 @@
  * ============================================================================
  **/
 
+/**
+ * Number of max valid items in the purchase ledger. (Larger ids are kept in the client map)
+ **/
+#define EXTRAITEMS_LEDGER_MAX 128
+
+/**
+ * @section Arrays to store the item purchase ledger.
+ **/
+int ItemsLedgerCount[MAXPLAYERS+1][EXTRAITEMS_LEDGER_MAX];
+int ItemsLedgerGeneration[MAXPLAYERS+1][EXTRAITEMS_LEDGER_MAX];
+int ItemsLedgerRound[MAXPLAYERS+1];
+/**
+ * @endsection
+ **/
+ 
 /**
  * @section Item native data indexes.
  **/
@@ -43,6 +58,19 @@ enum
  * @endsection
  **/
  
+/**
+ * @section Item hook types.
+ **/
+enum
+{
+    EXTRAITEMS_HOOK_VALIDATE,
+    EXTRAITEMS_HOOK_BUY,
+    EXTRAITEMS_HOOK_MAX
+};
+/**
+ * @endsection
+ **/
+ 
 /**
  * @brief Extraitems module init function.
  **/
@@ -99,6 +127,9 @@ void ExtraItemsOnLoad(/*void*/)
  **/
 void ExtraItemsOnCacheData(/*void*/)
 {
+    // Remove cached menu lines (indexes can be changed)
+    MenusClearCache();
+    
     // Gets config file path
     static char sPathItems[PLATFORM_LINE_LENGTH];
     ConfigGetConfigPath(File_ExtraItems, sPathItems, sizeof(sPathItems));
@@ -121,7 +152,7 @@ void ExtraItemsOnCacheData(/*void*/)
         LogEvent(false, LogType_Fatal, LOG_GAME_EVENTS, LogModule_ExtraItems, "Config Validation", "No usable data found in extraitems config file: \"%s\"", sPathItems);
         return;
     }
-
+    
     // i = array index
     for(int i = 0; i < iSize; i++)
     {
@@ -174,6 +205,16 @@ void ExtraItemsOnCacheData(/*void*/)
  **/
 public void ExtraItemsOnConfigReload(/*void*/)
 {
+    // Remove item hooks (indexes can be changed, plugins will hook them again)
+    ItemsClearHooks();
+    
+    // i = client index
+    for(int i = 1; i <= MaxClients; i++)
+    {
+        // Resets limits (indexes can be changed)
+        ItemsRemoveLimits(i);
+    }
+    
     // Reloads extraitems config
     ExtraItemsOnLoad();
 }
@@ -222,6 +263,11 @@ void ExtraItemsOnNativeInit(/*void*/)
     CreateNative("ZP_GetExtraItemLimit",        API_GetExtraItemLimit); 
     CreateNative("ZP_GetExtraItemGroup",        API_GetExtraItemGroup); 
     CreateNative("ZP_GetExtraItemClass",        API_GetExtraItemClass);
+    CreateNative("ZP_HookExtraItemValidate",    API_HookExtraItemValidate);
+    CreateNative("ZP_HookExtraItemBuy",         API_HookExtraItemBuy);
+    
+    // Initialize an item hooks array
+    gServerData.ItemHooks = new ArrayList(EXTRAITEMS_HOOK_MAX);
 }
 
 /**
@@ -253,13 +299,13 @@ public int API_GiveClientExtraItem(Handle hPlugin, int iNumParams)
 
     // Call forward
     Action resultHandle;
-    gForwardData._OnClientValidateExtraItem(clientIndex, iD, resultHandle);
+    ItemsOnValidate(clientIndex, iD, resultHandle);
 
     // Validate handle
     if(resultHandle == Plugin_Continue || resultHandle == Plugin_Changed)
     {
         // Call forward
-        gForwardData._OnClientBuyExtraItem(clientIndex, iD); /// Buy item
+        ItemsOnBuy(clientIndex, iD); /// Buy item
         return true;
     }
     
@@ -594,6 +640,54 @@ public int API_GetExtraItemClass(Handle hPlugin, int iNumParams)
     return SetNativeString(2, sClass, maxLen);
 }
 
+/**
+ * @brief Binds a validation callback to the item.
+ *
+ * @note native int ZP_HookExtraItemValidate(iD, callback);
+ **/
+public int API_HookExtraItemValidate(Handle hPlugin, int iNumParams)
+{
+    // Gets item index from native cell
+    int iD = GetNativeCell(1);
+    
+    // Validate index
+    if(iD < 0 || iD >= gServerData.ExtraItems.Length)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_ExtraItems, "Native Validation", "Invalid the item index (%d)", iD);
+        return -1;
+    }
+    
+    // Bind callback
+    ItemsHookItem(iD, EXTRAITEMS_HOOK_VALIDATE, hPlugin, GetNativeFunction(2));
+    
+    // Return on success
+    return iD;
+}
+
+/**
+ * @brief Binds a buying callback to the item.
+ *
+ * @note native int ZP_HookExtraItemBuy(iD, callback);
+ **/
+public int API_HookExtraItemBuy(Handle hPlugin, int iNumParams)
+{
+    // Gets item index from native cell
+    int iD = GetNativeCell(1);
+    
+    // Validate index
+    if(iD < 0 || iD >= gServerData.ExtraItems.Length)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_ExtraItems, "Native Validation", "Invalid the item index (%d)", iD);
+        return -1;
+    }
+    
+    // Bind callback
+    ItemsHookItem(iD, EXTRAITEMS_HOOK_BUY, hPlugin, GetNativeFunction(2));
+    
+    // Return on success
+    return iD;
+}
+
 /*
  * Extra items data reading API.
  */
@@ -696,15 +790,14 @@ int ItemsGetLimit(int iD)
  **/
 void ItemsRemoveLimits(int clientIndex)
 {
-    // If array hasn't been created, then create
-    if(gClientData[clientIndex].ItemLimit == null)
+    // Starts a new ledger generation (old counts are ignored)
+    ItemsLedgerRound[clientIndex]++;
+    
+    // Clear out the overflow map of all data
+    if(gClientData[clientIndex].ItemLimit != null)
     {
-        // Initialize a buy limit array
-        gClientData[clientIndex].ItemLimit = new StringMap();
+        gClientData[clientIndex].ItemLimit.Clear();
     }
-
-    // Clear out the array of all data
-    gClientData[clientIndex].ItemLimit.Clear();
 }
 
 /**
@@ -716,19 +809,34 @@ void ItemsRemoveLimits(int clientIndex)
  **/
 void ItemsSetLimits(int clientIndex, int iD, int iLimit)
 {
-    // If array hasn't been created, then create
-    if(gClientData[clientIndex].ItemLimit == null)
+    // Validate index
+    if(iD < 0)
     {
-        // Initialize a buy limit array
-        gClientData[clientIndex].ItemLimit = new StringMap();
+        return;
+    }
+    
+    // Validate index out of the ledger
+    if(iD >= EXTRAITEMS_LEDGER_MAX)
+    {
+        // If array hasn't been created, then create
+        if(gClientData[clientIndex].ItemLimit == null)
+        {
+            // Initialize a buy limit array
+            gClientData[clientIndex].ItemLimit = new StringMap();
+        }
+        
+        // Initialize key char
+        static char sKey[SMALL_LINE_LENGTH];
+        IntToString(iD, sKey, sizeof(sKey));
+        
+        // Sets buy limit for the client
+        gClientData[clientIndex].ItemLimit.SetValue(sKey, iLimit);
+        return;
     }
-
-    // Initialize key char
-    static char sKey[SMALL_LINE_LENGTH];
-    IntToString(iD, sKey, sizeof(sKey));
     
     // Sets buy limit for the client
-    gClientData[clientIndex].ItemLimit.SetValue(sKey, iLimit);
+    ItemsLedgerCount[clientIndex][iD] = iLimit;
+    ItemsLedgerGeneration[clientIndex][iD] = ItemsLedgerRound[clientIndex];
 }
 
 /**
@@ -739,20 +847,32 @@ void ItemsSetLimits(int clientIndex, int iD, int iLimit)
  **/
 int ItemsGetLimits(int clientIndex, int iD)
 {
-    // If array hasn't been created, then create
-    if(gClientData[clientIndex].ItemLimit == null)
+    // Validate index
+    if(iD < 0)
     {
-        // Initialize a buy limit array
-        gClientData[clientIndex].ItemLimit = new StringMap();
+        return 0;
     }
     
-    // Initialize key char
-    static char sKey[SMALL_LINE_LENGTH];
-    IntToString(iD, sKey, sizeof(sKey));
+    // Validate index out of the ledger
+    if(iD >= EXTRAITEMS_LEDGER_MAX)
+    {
+        // Validate array
+        if(gClientData[clientIndex].ItemLimit == null)
+        {
+            return 0;
+        }
+        
+        // Initialize key char
+        static char sKey[SMALL_LINE_LENGTH];
+        IntToString(iD, sKey, sizeof(sKey));
+        
+        // Gets buy limit for the client
+        int iLimit; gClientData[clientIndex].ItemLimit.GetValue(sKey, iLimit);
+        return iLimit;
+    }
     
-    // Gets buy limit for the client
-    int iLimit; gClientData[clientIndex].ItemLimit.GetValue(sKey, iLimit);
-    return iLimit;
+    // Gets buy limit for the client, if it was set in the current generation
+    return (ItemsLedgerGeneration[clientIndex][iD] == ItemsLedgerRound[clientIndex]) ? ItemsLedgerCount[clientIndex][iD] : 0;
 }
 
 /**
@@ -850,6 +970,146 @@ bool ItemsValidateClass(int clientIndex, int iD)
     return true;
 }
 
+/**
+ * @brief Calls the validation hooks of the item.
+ *
+ * @param clientIndex       The client index.
+ * @param iD                The item id.
+ * @param resultHandle      The result of the hooks.
+ **/
+void ItemsOnValidate(int clientIndex, int iD, Action &resultHandle)
+{
+    // Call forward
+    gForwardData._OnClientValidateExtraItem(clientIndex, iD, resultHandle);
+    
+    // Validate item hook
+    Handle hForward = ItemsGetHook(iD, EXTRAITEMS_HOOK_VALIDATE);
+    if(hForward != null)
+    {
+        // Call hook
+        Action hookResult;
+        Call_StartForward(hForward);
+        Call_PushCell(clientIndex);
+        Call_PushCell(iD);
+        Call_Finish(hookResult);
+        
+        // Keep the strongest result
+        if(hookResult > resultHandle)
+        {
+            resultHandle = hookResult;
+        }
+    }
+}
+
+/**
+ * @brief Calls the buying hooks of the item.
+ *
+ * @param clientIndex       The client index.
+ * @param iD                The item id.
+ **/
+void ItemsOnBuy(int clientIndex, int iD)
+{
+    // Call forward
+    gForwardData._OnClientBuyExtraItem(clientIndex, iD);
+    
+    // Validate item hook
+    Handle hForward = ItemsGetHook(iD, EXTRAITEMS_HOOK_BUY);
+    if(hForward != null)
+    {
+        // Call hook
+        Call_StartForward(hForward);
+        Call_PushCell(clientIndex);
+        Call_PushCell(iD);
+        Call_Finish();
+    }
+}
+
+/**
+ * @brief Gets the hook of the item.
+ *
+ * @param iD                The item id.
+ * @param iType             The hook type.
+ *
+ * @return                  The forward handle or null if there are no callbacks.
+ **/
+Handle ItemsGetHook(int iD, int iType)
+{
+    // Validate item hooks
+    if(iD >= gServerData.ItemHooks.Length)
+    {
+        return null;
+    }
+    
+    // Validate any callback
+    Handle hForward = gServerData.ItemHooks.Get(iD, iType);
+    if(hForward == null || !GetForwardFunctionCount(hForward))
+    {
+        return null;
+    }
+    
+    // Return on success
+    return hForward;
+}
+
+/**
+ * @brief Binds a callback to the item.
+ *
+ * @param iD                The item id.
+ * @param iType             The hook type.
+ * @param hPlugin           The plugin handle.
+ * @param fCallback         The callback function.
+ **/
+void ItemsHookItem(int iD, int iType, Handle hPlugin, Function fCallback)
+{
+    // Expand array up to the item index
+    static Handle hEmpty[EXTRAITEMS_HOOK_MAX];
+    int iSize = gServerData.ItemHooks.Length;
+    while(iSize <= iD)
+    {
+        gServerData.ItemHooks.PushArray(hEmpty, sizeof(hEmpty));
+        iSize++;
+    }
+    
+    // Validate forward
+    Handle hForward = gServerData.ItemHooks.Get(iD, iType);
+    if(hForward == null)
+    {
+        // Creates a private forward
+        hForward = (iType == EXTRAITEMS_HOOK_VALIDATE) ? CreateForward(ET_Hook, Param_Cell, Param_Cell) : CreateForward(ET_Ignore, Param_Cell, Param_Cell);
+        gServerData.ItemHooks.Set(iD, hForward, iType);
+    }
+    else
+    {
+        // Remove the same callback (hooks are repeated on each map)
+        RemoveFromForward(hForward, hPlugin, fCallback);
+    }
+    
+    // Adds the callback to the forward
+    AddToForward(hForward, hPlugin, fCallback);
+}
+
+/**
+ * @brief Removes all hooks of the items.
+ **/
+void ItemsClearHooks(/*void*/)
+{
+    // i = item index
+    int iSize = gServerData.ItemHooks.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // x = hook type
+        for(int x = 0; x < EXTRAITEMS_HOOK_MAX; x++)
+        {
+            // Close forward
+            Handle hForward = gServerData.ItemHooks.Get(i, x);
+            delete hForward;
+        }
+    }
+    
+    // Clear out the array
+    gServerData.ItemHooks.Clear();
+}
+
 /*
  * Menu extra items API.
  */
@@ -880,12 +1140,7 @@ void ItemsMenu(int clientIndex)
 
     // Initialize variables
     static char sBuffer[NORMAL_LINE_LENGTH];
-    static char sName[SMALL_LINE_LENGTH];
     static char sInfo[SMALL_LINE_LENGTH];
-    static char sLevel[SMALL_LINE_LENGTH];
-    static char sLimit[SMALL_LINE_LENGTH];
-    static char sOnline[SMALL_LINE_LENGTH];
-    static char sGroup[SMALL_LINE_LENGTH];
     
     // Creates extra items menu handle
     Menu hMenu = CreateMenu(ItemsMenuSlots);
@@ -896,15 +1151,22 @@ void ItemsMenu(int clientIndex)
     // Sets title
     hMenu.SetTitle("%t", "buy extraitems");
     
-    // Initialize forward
-    Action resultHandle;
+    // Gets menu lines
+    ArrayList hList = ItemsGetLines(clientIndex);
     
-    // i = extraitem index
-    int iSize = gServerData.ExtraItems.Length;
+    // Initialize variables
+    Action resultHandle; MenuLineData lineData; int iPlaying = fnGetPlaying();
+    
+    // i = line index
+    int iSize = hList.Length;
     for(int i = 0; i < iSize; i++)
     {
+        // Gets extra item data from the list
+        hList.GetArray(i, lineData, sizeof(lineData));
+        int iD = lineData.ID;
+        
         // Call forward
-        gForwardData._OnClientValidateExtraItem(clientIndex, i, resultHandle);
+        ItemsOnValidate(clientIndex, iD, resultHandle);
         
         // Skip, if item is disabled
         if(resultHandle == Plugin_Stop)
@@ -912,25 +1174,16 @@ void ItemsMenu(int clientIndex)
             continue;
         }
         
-        // Skip some item, if class isn't equal
-        if(!ItemsValidateClass(clientIndex, i)) 
-        {
-            continue;
-        }
+        // Gets extra item limits
+        int iLimits = ItemsGetLimits(clientIndex, iD);
+        bool bGroup = hasLength(lineData.Group) && !IsPlayerInGroup(clientIndex, lineData.Group);
         
-        // Gets extra item data
-        ItemsGetName(i, sName, sizeof(sName));
-        ItemsGetGroup(i, sGroup, sizeof(sGroup));
-
         // Format some chars for showing in menu
-        FormatEx(sLevel, sizeof(sLevel), "%t", "level", ItemsGetLevel(i));
-        FormatEx(sLimit, sizeof(sLimit), "%t", "limit", ItemsGetLimit(i));
-        FormatEx(sOnline, sizeof(sOnline), "%t", "online", ItemsGetOnline(i));
-        FormatEx(sBuffer, sizeof(sBuffer), (ItemsGetCost(i)) ? "%t  %s  %t" : "%t  %s", sName, (hasLength(sGroup) && !IsPlayerInGroup(clientIndex, sGroup)) ? sGroup : (gClientData[clientIndex].Level < ItemsGetLevel(i)) ? sLevel : (ItemsGetLimit(i) && ItemsGetLimit(i) <= ItemsGetLimits(clientIndex, i)) ? sLimit : (fnGetPlaying() < ItemsGetOnline(i)) ? sOnline :  "", "price", ItemsGetCost(i), "money");
+        MenusFormatLine(clientIndex, iPlaying, iLimits, bGroup, lineData, sBuffer, sizeof(sBuffer));
 
         // Show option
-        IntToString(i, sInfo, sizeof(sInfo));
-        hMenu.AddItem(sInfo, sBuffer, MenusGetItemDraw(resultHandle == Plugin_Handled || (hasLength(sGroup) && !IsPlayerInGroup(clientIndex, sGroup)) || gClientData[clientIndex].Level < ItemsGetLevel(i) || fnGetPlaying() < ItemsGetOnline(i) || ItemsGetLimit(i) && ItemsGetLimit(i) <= ItemsGetLimits(clientIndex, i) || gClientData[clientIndex].Money < ItemsGetCost(i) ? false : true));
+        IntToString(iD, sInfo, sizeof(sInfo));
+        hMenu.AddItem(sInfo, sBuffer, MenusGetItemDraw(resultHandle == Plugin_Handled || bGroup || gClientData[clientIndex].Level < lineData.Level || iPlaying < lineData.Online || lineData.Limit && lineData.Limit <= iLimits || gClientData[clientIndex].Money < lineData.Cost ? false : true));
     }
     
     // If there are no cases, add an "(Empty)" line
@@ -949,6 +1202,67 @@ void ItemsMenu(int clientIndex)
     hMenu.Display(clientIndex, MENU_TIME_FOREVER); 
 }
 
+/**
+ * @brief Gets the cached extra item lines of the menu.
+ *
+ * @param clientIndex       The client index.
+ *
+ * @return                  The list of the menu lines. (MenuLineData)
+ **/
+ArrayList ItemsGetLines(int clientIndex)
+{
+    // Gets cached lines
+    bool bCreated;
+    ArrayList hList = MenusGetCache(clientIndex, "extraitems", 0, bCreated);
+    
+    // Validate cache
+    if(bCreated)
+    {
+        // i = extraitem index
+        MenuLineData lineData;
+        int iSize = gServerData.ExtraItems.Length;
+        for(int i = 0; i < iSize; i++)
+        {
+            // Skip some item, if class isn't equal
+            if(!ItemsValidateClass(clientIndex, i)) 
+            {
+                continue;
+            }
+            
+            // Gets extra item data
+            lineData.ID = i;
+            lineData.Cost = ItemsGetCost(i);
+            lineData.Level = ItemsGetLevel(i);
+            lineData.Limit = ItemsGetLimit(i);
+            lineData.Online = ItemsGetOnline(i);
+            ItemsGetName(i, lineData.Name, sizeof(lineData.Name));
+            ItemsGetGroup(i, lineData.Group, sizeof(lineData.Group));
+            
+            // Format some chars for showing in menu
+            Format(lineData.Name, sizeof(lineData.Name), "%t", lineData.Name);
+            FormatEx(lineData.LevelInfo, sizeof(lineData.LevelInfo), "%t", "level", lineData.Level);
+            FormatEx(lineData.LimitInfo, sizeof(lineData.LimitInfo), "%t", "limit", lineData.Limit);
+            FormatEx(lineData.OnlineInfo, sizeof(lineData.OnlineInfo), "%t", "online", lineData.Online);
+            
+            // Validate cost
+            if(lineData.Cost) 
+            {
+                FormatEx(lineData.Price, sizeof(lineData.Price), "%t", "price", lineData.Cost, "money");
+            }
+            else
+            {
+                lineData.Price[0] = '\0';
+            }
+            
+            // Push data into array
+            hList.PushArray(lineData, sizeof(lineData));
+        }
+    }
+    
+    // Return on success
+    return hList;
+}
+
 /**
  * @brief Called when client selects option in the extra items menu, and handles it.
  *  
@@ -1009,7 +1323,7 @@ public int ItemsMenuSlots(Menu hMenu, MenuAction mAction, int clientIndex, int m
             
             // Call forward
             Action resultHandle;
-            gForwardData._OnClientValidateExtraItem(clientIndex, iD, resultHandle);
+            ItemsOnValidate(clientIndex, iD, resultHandle);
 
             // Validate handle
             if(resultHandle == Plugin_Continue || resultHandle == Plugin_Changed)
@@ -1018,7 +1332,7 @@ public int ItemsMenuSlots(Menu hMenu, MenuAction mAction, int clientIndex, int m
                 if(ItemsValidateClass(clientIndex, iD)) 
                 {
                     // Call forward
-                    gForwardData._OnClientBuyExtraItem(clientIndex, iD); /// Buy item
+                    ItemsOnBuy(clientIndex, iD); /// Buy item
             
                     // If help messages enabled, then show info
                     if(gCvarList[CVAR_MESSAGES_ITEM_ALL].BoolValue)
@@ -59,6 +59,64 @@ enum
  * @endsection
  **/
  
+/**
+ * @brief Size of the dense hitgroup table. (Covers all engine hitgroup values)
+ **/
+#define HITGROUPS_TABLE_SIZE 16
+
+/**
+ * @section Struct of the precomputed hitgroup data.
+ **/
+enum struct HitGroupData
+{
+    int Index;          /** The array index of the hitgroup config, or -1 if not configured. */
+    bool Damage;
+    bool Protect;
+    float KnockBack;
+    float Armor;
+    float Bonus;
+    float Heavy;
+    
+    /**
+     * @brief Resets all variables.
+     **/
+    void ResetVars(/*void*/)
+    {
+        this.Index     = -1;
+        this.Damage    = true;
+        this.Protect   = true;
+        this.KnockBack = 1.0;
+        this.Armor     = 0.5;
+        this.Bonus     = 0.5;
+        this.Heavy     = 1.0;
+    }
+}
+/**
+ * @endsection
+ **/
+ 
+/**
+ * Array to store the hitgroup data indexed by the engine hitgroup.
+ **/
+HitGroupData gHitGroupData[HITGROUPS_TABLE_SIZE];
+
+/**
+ * @section Struct of the filtered damage subscription.
+ **/
+enum struct DamageHookData
+{
+    Handle Forward;     /** The private forward with a subscribed callback. */
+    Handle Plugin;      /** The plugin of the subscribed callback. */
+    Function Callback;  /** The subscribed callback. */
+    int VictimClass;
+    int AttackerClass;
+    int WeaponID;
+    int Bits;
+}
+/**
+ * @endsection
+ **/
+ 
 /**
  * @brief Hit groups module init function.
  **/ 
@@ -136,6 +194,13 @@ void HitGroupsOnLoad(/*void*/)
  **/
 void HitGroupsOnCacheData(/*void*/)
 {
+    // i = hitgroup index
+    for(int i = 0; i < HITGROUPS_TABLE_SIZE; i++)
+    {
+        // Reset the lookup table
+        gHitGroupData[i].ResetVars();
+    }
+
     // Gets config file path
     static char sPathGroups[PLATFORM_LINE_LENGTH];
     ConfigGetConfigPath(File_HitGroups, sPathGroups, sizeof(sPathGroups)); 
@@ -182,6 +247,20 @@ void HitGroupsOnCacheData(/*void*/)
         arrayHitGroup.Push(kvHitGroups.GetFloat("bonus", 0.5));                   // Index: 5
         arrayHitGroup.Push(kvHitGroups.GetFloat("heavy", 0.5));                   // Index: 6
         arrayHitGroup.Push(ConfigKvGetStringBool(kvHitGroups, "protect", "yes")); // Index: 7
+        
+        // Validate engine hitgroup (first entry wins on duplicates)
+        int iHitGroup = HitGroupsGetIndex(i);
+        if(0 <= iHitGroup < HITGROUPS_TABLE_SIZE && gHitGroupData[iHitGroup].Index == -1)
+        {
+            // Store data into the lookup table
+            gHitGroupData[iHitGroup].Index     = i;
+            gHitGroupData[iHitGroup].Damage    = HitGroupsIsDamage(i);
+            gHitGroupData[iHitGroup].Protect   = HitGroupsIsProtect(i);
+            gHitGroupData[iHitGroup].KnockBack = HitGroupsGetKnockBack(i);
+            gHitGroupData[iHitGroup].Armor     = HitGroupsGetArmor(i);
+            gHitGroupData[iHitGroup].Bonus     = HitGroupsGetBonus(i);
+            gHitGroupData[iHitGroup].Heavy     = HitGroupsGetHeavy(i);
+        }
     }
     
     // We're done with this file now, so we can close it
@@ -310,16 +389,11 @@ public Action HitGroupsOnTraceAttack(int clientIndex, int &attackerIndex, int &i
     // If custom hitgroups enabled, then apply multipliers
     if(gCvarList[CVAR_HITGROUP].BoolValue)
     {
-        // Validate hitgroup index
-        int iHitIndex = HitGroupToIndex(iHitGroup);
-        if(iHitIndex != -1)
+        // Validate damage
+        if(0 <= iHitGroup < HITGROUPS_TABLE_SIZE && !gHitGroupData[iHitGroup].Damage)
         {
-            // Validate damage
-            if(!HitGroupsIsDamage(iHitIndex))
-            {
-                // Stop trace
-                return Plugin_Handled;
-            }
+            // Stop trace
+            return Plugin_Handled;
         }
     }
 
@@ -386,9 +460,10 @@ public Action HitGroupsOnTakeDamage(int clientIndex, int &attackerIndex, int &in
  * @param flDamage          The amount of damage inflicted.
  * @param iBits             The type of damage inflicted.
  * @param weaponIndex       The weapon index or -1 for unspecified.
+ * @param iIconID           (Optional) The weapon id for a death icon or -1 for unspecified.
  * @return                  True to allow real damage or false to block real damage.
  **/
-bool HitGroupsOnCalculateDamage(int clientIndex, int &attackerIndex, int &inflictorIndex, float &flDamage, int &iBits, int &weaponIndex)
+bool HitGroupsOnCalculateDamage(int clientIndex, int &attackerIndex, int &inflictorIndex, float &flDamage, int &iBits, int &weaponIndex, int iIconID = -1)
 {
     // Validate victim
     if(!IsPlayerAlive(clientIndex))
@@ -398,7 +473,7 @@ bool HitGroupsOnCalculateDamage(int clientIndex, int &attackerIndex, int &inflic
     }
     
     // Initialize variables
-    int iIndex = -1; bool bInfectProtect = true; float flDamageRatio = 1.0; float flArmorRatio = 0.5; float flBonusRatio = 0.5; float flKnockRatio = ClassGetKnockBack(gClientData[clientIndex].Class); 
+    int iIndex = iIconID; bool bInfectProtect = true; float flDamageRatio = 1.0; float flArmorRatio = 0.5; float flBonusRatio = 0.5; float flKnockRatio = ClassGetKnockBack(gClientData[clientIndex].Class); 
 
     // Gets the hitgroup index
     int iHitGroup = ToolsGetClientHitGroup(clientIndex);
@@ -416,32 +491,30 @@ bool HitGroupsOnCalculateDamage(int clientIndex, int &attackerIndex, int &inflic
     if(gCvarList[CVAR_HITGROUP].BoolValue)
     {
         // Validate hitgroup index
-        int iHitIndex = HitGroupToIndex(iHitGroup);
-        if(iHitIndex != -1)
+        if(0 <= iHitGroup < HITGROUPS_TABLE_SIZE && gHitGroupData[iHitGroup].Index != -1)
         {
+            // Validate damage
+            if(!gHitGroupData[iHitGroup].Damage)
+            {
+                // Block damage
+                return false;
+            }
+            
             // Reset new multipliers
-            flArmorRatio = HitGroupsGetArmor(iHitIndex);
-            flBonusRatio = HitGroupsGetBonus(iHitIndex);
+            flArmorRatio = gHitGroupData[iHitGroup].Armor;
+            flBonusRatio = gHitGroupData[iHitGroup].Bonus;
             
             // Gets the protect value
-            bInfectProtect = HitGroupsIsProtect(iHitIndex);
+            bInfectProtect = gHitGroupData[iHitGroup].Protect;
 
             // Add multiplier
-            flKnockRatio *= HitGroupsGetKnockBack(iHitIndex);
+            flKnockRatio *= gHitGroupData[iHitGroup].KnockBack;
 
             // Validate heavy
-            bool bHeavySuit = ToolsGetClientHeavySuit(clientIndex);
-            if(bHeavySuit)
+            if(ToolsGetClientHeavySuit(clientIndex))
             {
                 // Add multiplier
-                flDamageRatio *= HitGroupsGetHeavy(iHitIndex);
-            }
-            
-            // Validate damage
-            if(!HitGroupsIsDamage(iHitIndex))
-            {
-                // Block damage
-                return false;
+                flDamageRatio *= gHitGroupData[iHitGroup].Heavy;
             }
         }
     }
@@ -450,6 +523,7 @@ bool HitGroupsOnCalculateDamage(int clientIndex, int &attackerIndex, int &inflic
     
     // Call forward
     gForwardData._OnClientDamaged(clientIndex, attackerIndex, inflictorIndex, flDamage, iBits, weaponIndex);
+    HitGroupsOnClientHooks(clientIndex, attackerIndex, inflictorIndex, flDamage, iBits, weaponIndex);
 
     // Validate damage
     if(flDamage < 0.0)
@@ -559,11 +633,10 @@ bool HitGroupsOnCalculateDamage(int clientIndex, int &attackerIndex, int &inflic
     if(attackerIndex > 0 && clientIndex != attackerIndex)
     {
         // Give rewards for applied damage
-        HitGroupsGiveMoney(attackerIndex, iDamage);
-        HitGroupsGiveExp(attackerIndex, iDamage);
+        HitGroupsGiveReward(attackerIndex, iDamage);
         
         // If help messages enabled, then show info
-        if(gCvarList[CVAR_MESSAGES_DAMAGE].BoolValue) TranslationPrintHintText(attackerIndex, "damage info", (iHealth > 0) ? iHealth : 0);
+        if(gCvarList[CVAR_MESSAGES_DAMAGE].BoolValue) HitGroupsGiveHint(attackerIndex, clientIndex, iDamage, iHealth);
 
         // Client was damaged by 'bullet' or 'knife'
         if(iBits & DMG_NEVERGIB)
@@ -641,6 +714,72 @@ bool HitGroupsOnCalculateDamage(int clientIndex, int &attackerIndex, int &inflic
     return true;
 }
 
+/**
+ * @brief Calls the damage subscribers which are matched the filters.
+ *
+ * @param clientIndex       The victim index.
+ * @param attackerIndex     The attacker index.
+ * @param inflictorIndex    The inflictor index.
+ * @param flDamage          The amount of damage inflicted.
+ * @param iBits             The type of damage inflicted.
+ * @param weaponIndex       The weapon index or -1 for unspecified.
+ **/
+void HitGroupsOnClientHooks(int clientIndex, int &attackerIndex, int &inflictorIndex, float &flDamage, int &iBits, int &weaponIndex)
+{
+    // Validate any subscribers
+    if(!gServerData.DamageHooks.Length)
+    {
+        return;
+    }
+    
+    // Gets the filter values
+    int iVictimClass = gClientData[clientIndex].Class;
+    int iAttackerClass = IsPlayerExist(attackerIndex, false) ? gClientData[attackerIndex].Class : -1;
+    int iWeaponID = IsValidEdict(weaponIndex) ? WeaponsGetCustomID(weaponIndex) : -1;
+    int iProjectileID = (inflictorIndex > MaxClients && IsValidEdict(inflictorIndex)) ? WeaponsGetCustomID(inflictorIndex) : -1;
+    int iDamageBits = iBits;
+    
+    // Initialize hook data
+    DamageHookData hookData;
+    
+    // i = hook index (callbacks could unsubscribe during the loop)
+    for(int i = 0; i < gServerData.DamageHooks.Length; i++)
+    {
+        // Gets hook data
+        gServerData.DamageHooks.GetArray(i, hookData, sizeof(hookData));
+        
+        // If plugin was unloaded, then remove the subscription
+        if(!GetForwardFunctionCount(hookData.Forward))
+        {
+            // Close forward
+            delete hookData.Forward;
+            
+            // Remove hook from array
+            gServerData.DamageHooks.Erase(i);
+
+            // Backtrack one index, because we deleted it out from under the loop
+            i--;
+            continue;
+        }
+        
+        // Validate filters
+        if(hookData.VictimClass != -1 && hookData.VictimClass != iVictimClass) continue;
+        if(hookData.AttackerClass != -1 && hookData.AttackerClass != iAttackerClass) continue;
+        if(hookData.WeaponID != -1 && hookData.WeaponID != iWeaponID && hookData.WeaponID != iProjectileID) continue;
+        if(hookData.Bits && !(hookData.Bits & iDamageBits)) continue;
+        
+        // Call forward
+        Call_StartForward(hookData.Forward);
+        Call_PushCell(clientIndex);
+        Call_PushCellRef(attackerIndex);
+        Call_PushCellRef(inflictorIndex);
+        Call_PushFloatRef(flDamage);
+        Call_PushCellRef(iBits);
+        Call_PushCellRef(weaponIndex);
+        Call_Finish();
+    }
+}
+
 /*
  * Hit groups natives API.
  */
@@ -651,6 +790,9 @@ bool HitGroupsOnCalculateDamage(int clientIndex, int &attackerIndex, int &inflic
 void HitGroupsOnNativeInit(/*void*/) 
 {
     CreateNative("ZP_TakeDamage",           API_TakeDamage);
+    CreateNative("ZP_RadiusDamage",         API_RadiusDamage);
+    CreateNative("ZP_HookClientDamaged",    API_HookClientDamaged);
+    CreateNative("ZP_UnhookClientDamaged",  API_UnhookClientDamaged);
     CreateNative("ZP_GetNumberHitGroup",    API_GetNumberHitGroup);
     CreateNative("ZP_GetHitGroupID",        API_GetHitGroupID);
     CreateNative("ZP_GetHitGroupNameID",    API_GetHitGroupNameID);
@@ -662,6 +804,9 @@ void HitGroupsOnNativeInit(/*void*/)
     CreateNative("ZP_GetHitGroupBonus",     API_GetHitGroupBonus);
     CreateNative("ZP_GetHitGroupHeavy",     API_GetHitGroupHeavy);
     CreateNative("ZP_IsHitGroupProtect",    API_IsHitGroupProtect);
+    
+    // Initialize a damage subscribers array
+    gServerData.DamageHooks = new ArrayList(sizeof(DamageHookData));
 }
  
 /**
@@ -705,6 +850,118 @@ public int API_TakeDamage(Handle hPlugin, int iNumParams)
     return true;
 }
  
+/**
+ * @brief Applies core damage to all players within a sphere.
+ *
+ * @note native int ZP_RadiusDamage(center, radius, damage, falloff, attackerIndex, inflictorIndex, weaponID, bits);
+ **/
+public int API_RadiusDamage(Handle hPlugin, int iNumParams)
+{
+    // Gets origin from native cell
+    static float vPosition[3];
+    GetNativeArray(1, vPosition, sizeof(vPosition));
+    
+    // Gets radius from native cell
+    float flRadius = GetNativeCell(2);
+    
+    // Validate radius
+    if(flRadius <= 0.0)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_HitGroups, "Native Validation", "Invalid the radius (%f)", flRadius);
+        return -1;
+    }
+    
+    // Gets weapon index from native cell
+    int iD = GetNativeCell(7);
+    
+    // Validate index
+    if(iD < -1 || iD >= gServerData.Weapons.Length)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_HitGroups, "Native Validation", "Invalid the weapon index (%d)", iD);
+        return -1;
+    }
+    
+    // Return the value
+    return HitGroupsRadiusDamage(vPosition, flRadius, GetNativeCell(3), GetNativeCell(4), GetNativeCell(5), GetNativeCell(6), iD, GetNativeCell(8));
+}
+ 
+/**
+ * @brief Subscribes a callback to the damage pipeline with filters.
+ *
+ * @note native void ZP_HookClientDamaged(callback, victimClass, attackerClass, weaponID, bits);
+ **/
+public int API_HookClientDamaged(Handle hPlugin, int iNumParams)
+{
+    // Gets callback from native cell
+    Function fCallback = GetNativeFunction(1);
+    
+    // Initialize hook data
+    DamageHookData hookData;
+
+    // Find the existing subscription of the callback
+    int iD = HitGroupsFindHook(hPlugin, fCallback, hookData);
+    if(iD == -1)
+    {
+        // Creates a private forward
+        hookData.Forward  = CreateForward(ET_Ignore, Param_Cell, Param_CellByRef, Param_CellByRef, Param_FloatByRef, Param_CellByRef, Param_CellByRef);
+        hookData.Plugin   = hPlugin;
+        hookData.Callback = fCallback;
+    }
+    
+    // Adds the callback to the forward (once, the reloaded plugin could reuse the handle)
+    if(!GetForwardFunctionCount(hookData.Forward))
+    {
+        AddToForward(hookData.Forward, hPlugin, fCallback);
+    }
+    
+    // Gets filters from native cells
+    hookData.VictimClass   = GetNativeCell(2);
+    hookData.AttackerClass = GetNativeCell(3);
+    hookData.WeaponID      = GetNativeCell(4);
+    hookData.Bits          = GetNativeCell(5);
+    
+    // Store hook data
+    if(iD == -1)
+    {
+        gServerData.DamageHooks.PushArray(hookData, sizeof(hookData));
+    }
+    else
+    {
+        gServerData.DamageHooks.SetArray(iD, hookData, sizeof(hookData));
+    }
+    
+    // Return on success
+    return true;
+}
+
+/**
+ * @brief Unsubscribes a callback from the damage pipeline.
+ *
+ * @note native bool ZP_UnhookClientDamaged(callback);
+ **/
+public int API_UnhookClientDamaged(Handle hPlugin, int iNumParams)
+{
+    // Initialize hook data
+    DamageHookData hookData;
+
+    // Find the existing subscription of the callback
+    int iD = HitGroupsFindHook(hPlugin, GetNativeFunction(1), hookData);
+    if(iD == -1)
+    {
+        return false;
+    }
+    
+    // Removes the callback and close forward
+    RemoveFromForward(hookData.Forward, hPlugin, hookData.Callback);
+    delete hookData.Forward;
+    
+    // Remove hook from array
+    gServerData.DamageHooks.Erase(iD);
+    
+    // Return on success
+    return true;
+}
+
 /**
  * @brief Gets the amount of all hitgrups.
  *
@@ -1104,22 +1361,42 @@ int HitGroupsNameToIndex(char[] sName)
  **/
 int HitGroupToIndex(int iHitGroup)
 {
-    // i = box index
-    int iSize = gServerData.HitGroups.Length;
+    // Validate hitgroup index
+    if(iHitGroup < 0 || iHitGroup >= HITGROUPS_TABLE_SIZE)
+    {
+        return -1;
+    }
+    
+    // Return the array index from the lookup table
+    return gHitGroupData[iHitGroup].Index;
+}
+
+/**
+ * @brief Find the array index at which the damage subscription is at.
+ * 
+ * @param hPlugin           The plugin handle.
+ * @param fCallback         The callback function.
+ * @param hookData          The hook data output.
+ * @return                  The array index containing the given callback.
+ **/
+int HitGroupsFindHook(Handle hPlugin, Function fCallback, DamageHookData hookData)
+{
+    // i = hook index
+    int iSize = gServerData.DamageHooks.Length;
     for(int i = 0; i < iSize; i++)
     {
-        // Gets hitgroup index at this array index
-        int iIndex = HitGroupsGetIndex(i);
+        // Gets hook data
+        gServerData.DamageHooks.GetArray(i, hookData, sizeof(hookData));
         
-        // If hitgroup indexes match, then return array index
-        if(iHitGroup == iIndex)
+        // If callback was subscribed, then return index
+        if(hookData.Plugin == hPlugin && hookData.Callback == fCallback)
         {
             // Return this index
             return i;
         }
     }
     
-    // Hitgroup index doesn't exist
+    // Callback doesn't exist
     return -1;
 }
 
@@ -1213,6 +1490,80 @@ bool HitGroupsValidateArmor(int clientIndex, int iHitGroup)
     return bApplyArmor;
 }
 
+/**
+ * @brief Applies the damage to all players within a sphere in one pass.
+ *
+ * @note Works like a player only env_explosion without a helper entity.
+ *       The victims behind the world brushes are skipped.
+ *
+ * @param vPosition         The center of the sphere.
+ * @param flRadius          The sphere radius.
+ * @param flDamage          The amount of damage at the center.
+ * @param flFalloff         The part of the damage lost at the edge. (0.0 = no falloff, 1.0 = no damage at the edge)
+ * @param attackerIndex     The attacker index.
+ * @param inflictorIndex    The inflictor index.
+ * @param iD                The weapon id for a death icon or -1 for unspecified.
+ * @param iBits             The type of damage inflicted.
+ * @return                  The amount of the victims.
+ **/
+int HitGroupsRadiusDamage(float vPosition[3], float flRadius, float flDamage, float flFalloff, int attackerIndex, int inflictorIndex, int iD, int iBits)
+{
+    // If mode doesn't started yet, then stop
+    if(!gServerData.RoundStart)
+    {
+        return 0;
+    }
+    
+    // Initialize vectors
+    static float vVictimPosition[3]; static float vEyePosition[3]; int iCount;
+    
+    // Find any players in the radius
+    int i; int it = 1; /// iterator
+    while((i = AntiStickFindPlayerInSphere(it, vPosition, flRadius)) != -1)
+    {
+        // Gets victim eye position
+        GetClientEyePosition(i, vEyePosition);
+        
+        // Validate visibility
+        TR_TraceRay(vPosition, vEyePosition, MASK_SOLID_BRUSHONLY, RayType_EndPoint);
+        if(TR_DidHit())
+        {
+            continue;
+        }
+        
+        // Gets victim origin
+        ToolsGetClientAbsOrigin(i, vVictimPosition);
+        
+        // Calculate the damage with the falloff (box intersection can be a bit outside)
+        float flDistance = GetVectorDistance(vPosition, vVictimPosition);
+        float flAmount = flDamage * (1.0 - flFalloff * ((flDistance < flRadius) ? (flDistance / flRadius) : 1.0));
+        if(flAmount <= 0.0)
+        {
+            continue;
+        }
+        
+        // Initialize the damage data of the victim
+        int victimAttacker = attackerIndex; int victimInflictor = inflictorIndex; int victimBits = iBits; int weaponIndex = INVALID_ENT_REFERENCE;
+        
+        // Validate lethal damage
+        if(HitGroupsOnCalculateDamage(i, victimAttacker, victimInflictor, flAmount, victimBits, weaponIndex, iD))
+        {
+            // If attacker/inflicter doens't exist, then make a self damage
+            if(!IsPlayerExist(victimAttacker, false)) victimAttacker = i;
+            if(!IsValidEdict(victimInflictor)) victimInflictor = i;
+
+            // Create the damage to kill
+            SDKHooks_TakeDamage(i, victimInflictor, victimAttacker, flAmount);
+        }
+        
+        // Count the victim
+        iCount++;
+    }
+    
+    // Return on success
+    return iCount;
+}
+
 /** 
  * @brief Sets velocity knockback for the applied damage.
  *
@@ -1255,6 +1606,151 @@ void HitGroupsApplyKnockBack(int clientIndex, int attackerIndex, float flKnockBa
     ToolsClientVelocity(clientIndex, vVelocity);
 }
 
+/**
+ * @brief Accumulate rewards for the applied damage until the frame end.
+ *
+ * @param clientIndex       The client index.
+ * @param iDamage           The damage amount.
+ **/
+void HitGroupsGiveReward(int clientIndex, int iDamage)
+{
+    // Validate damage
+    if(iDamage <= 0)
+    {
+        return;
+    }
+    
+    // If rewards wasn't requested in this frame, then schedule it
+    if(!gClientData[clientIndex].RewardDamage)
+    {
+        _call.HitGroupsOnRewardPost(clientIndex);
+    }
+    
+    // Increment total damage
+    gClientData[clientIndex].RewardDamage += iDamage;
+}
+
+/**
+ * @brief Client has been received rewards for the frame damage.
+ *
+ * @param userID            The user id.
+ **/
+public void HitGroupsOnRewardPost(int userID)
+{
+    // Gets client index from the user ID
+    int clientIndex = GetClientOfUserId(userID);
+
+    // Validate client
+    if(clientIndex)
+    {
+        // Gets the accumulated damage
+        int iDamage = gClientData[clientIndex].RewardDamage;
+        gClientData[clientIndex].RewardDamage = 0;
+        
+        // Give rewards once per frame
+        HitGroupsGiveMoney(clientIndex, iDamage);
+        HitGroupsGiveExp(clientIndex, iDamage);
+    }
+}
+
+/**
+ * @brief Accumulate damage info for the attacker/victim pair until the hint is printed.
+ *
+ * @param clientIndex       The attacker index.
+ * @param victimIndex       The victim index.
+ * @param iDamage           The damage amount.
+ * @param iHealth           The victim health after damage.
+ **/
+void HitGroupsGiveHint(int clientIndex, int victimIndex, int iDamage, int iHealth)
+{
+    // If victim was changed, then print the previous pair now
+    if(gClientData[clientIndex].HintVictim && gClientData[clientIndex].HintVictim != victimIndex)
+    {
+        HitGroupsPrintHint(clientIndex);
+    }
+    
+    // If hint wasn't requested yet, then schedule it
+    if(!gClientData[clientIndex].HintVictim)
+    {
+        // Gets the coalesce delay
+        float flDelay = gCvarList[CVAR_MESSAGES_DAMAGE_DELAY].FloatValue;
+        if(flDelay > 0.0)
+        {
+            gClientData[clientIndex].HintTimer = CreateTimer(flDelay, HitGroupsOnHintTimer, GetClientUserId(clientIndex), TIMER_FLAG_NO_MAPCHANGE);
+        }
+        else
+        {
+            _call.HitGroupsOnHintPost(clientIndex);
+        }
+    }
+    
+    // Store the pair data
+    gClientData[clientIndex].HintVictim  = victimIndex;
+    gClientData[clientIndex].HintDamage += iDamage;
+    gClientData[clientIndex].HintHealth  = (iHealth > 0) ? iHealth : 0;
+}
+
+/**
+ * @brief Prints the accumulated damage info to the attacker.
+ *
+ * @param clientIndex       The attacker index.
+ **/
+void HitGroupsPrintHint(int clientIndex)
+{
+    // Show info
+    TranslationPrintHintText(clientIndex, "damage info", gClientData[clientIndex].HintHealth, gClientData[clientIndex].HintDamage);
+    
+    // Cancel the pending hint of the pair
+    delete gClientData[clientIndex].HintTimer;
+    
+    // Resets the pair data
+    gClientData[clientIndex].HintVictim = 0;
+    gClientData[clientIndex].HintDamage = 0;
+}
+
+/**
+ * @brief Client has been received damage info at the next frame.
+ *
+ * @param userID            The user id.
+ **/
+public void HitGroupsOnHintPost(int userID)
+{
+    // Gets client index from the user ID
+    int clientIndex = GetClientOfUserId(userID);
+
+    // Validate client
+    if(clientIndex && gClientData[clientIndex].HintVictim)
+    {
+        // Show info
+        HitGroupsPrintHint(clientIndex);
+    }
+}
+
+/**
+ * @brief Timer callback, prints the accumulated damage info.
+ *
+ * @param hTimer            The timer handle.
+ * @param userID            The user id.
+ **/
+public Action HitGroupsOnHintTimer(Handle hTimer, int userID)
+{
+    // Gets client index from the user ID
+    int clientIndex = GetClientOfUserId(userID);
+    
+    // Validate client
+    if(clientIndex)
+    {
+        // Clear timer
+        gClientData[clientIndex].HintTimer = null;
+    }
+    
+    // Forward event to modules
+    HitGroupsOnHintPost(userID);
+    
+    // Destroy timer
+    return Plugin_Stop;
+}
+
 /**
  * @brief Reward money for the applied damage.
  *
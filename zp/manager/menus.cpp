@@ -41,6 +41,27 @@ enum
  * @endsection
  **/
  
+/**
+ * @section Struct of the cached menu line.
+ **/
+enum struct MenuLineData
+{
+    int ID;
+    int Cost;
+    int Level;
+    int Limit;
+    int Online;
+    char Name[NORMAL_LINE_LENGTH];
+    char Group[SMALL_LINE_LENGTH];
+    char Price[SMALL_LINE_LENGTH];
+    char LevelInfo[SMALL_LINE_LENGTH];
+    char LimitInfo[SMALL_LINE_LENGTH];
+    char OnlineInfo[SMALL_LINE_LENGTH];
+}
+/**
+ * @endsection
+ **/
+ 
 /**
  * @brief Prepare all menu data.
  **/
@@ -210,6 +231,9 @@ void MenusOnCommandInit(/*void*/)
     // Hook commands
     RegConsoleCmd("zp_main_menu", MenusOnCommandCatched, "Opens the main menu.");
     
+    // Initialize a menu cache
+    gServerData.MenuCache = new StringMap();
+    
     // Prepare all menu data
     MenusOnLoad();
 }
@@ -821,6 +845,82 @@ int MenusGetItemDraw(bool menuCondition)
     return menuCondition ? ITEMDRAW_DEFAULT : ITEMDRAW_DISABLED;
 }
 
+/**
+ * @brief Gets the cached lines of the menu section for the client language and class.
+ * 
+ * @param clientIndex       The client index.
+ * @param sMenu             The menu name.
+ * @param iSection          The section index.
+ * @param bCreated          True if the list was just created and should be filled, false otherwise.
+ *
+ * @return                  The list of the menu lines. (MenuLineData)
+ **/
+ArrayList MenusGetCache(int clientIndex, char[] sMenu, int iSection, bool &bCreated)
+{
+    // Format the cache key
+    static char sKey[SMALL_LINE_LENGTH];
+    FormatEx(sKey, sizeof(sKey), "%s %d %d %d", sMenu, GetClientLanguage(clientIndex), gClientData[clientIndex].Class, iSection);
+    
+    // Find the cached lines
+    ArrayList hList;
+    bCreated = !gServerData.MenuCache.GetValue(sKey, hList);
+    
+    // If lines wasn't cached, then create
+    if(bCreated)
+    {
+        hList = new ArrayList(sizeof(MenuLineData));
+        gServerData.MenuCache.SetValue(sKey, hList);
+    }
+    
+    // Return on success
+    return hList;
+}
+
+/**
+ * @brief Removes all cached menu lines.
+ *
+ * @note Should be called before caching any config which is used for the menu lines.
+ **/
+void MenusClearCache(/*void*/)
+{
+    // Gets the cache keys
+    StringMapSnapshot hSnapshot = gServerData.MenuCache.Snapshot();
+    
+    // i = key index
+    int iSize = hSnapshot.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Gets the key
+        static char sKey[SMALL_LINE_LENGTH];
+        hSnapshot.GetKey(i, sKey, sizeof(sKey));
+        
+        // Close the cached lines
+        ArrayList hList;
+        gServerData.MenuCache.GetValue(sKey, hList);
+        delete hList;
+    }
+    
+    // Clear out the cache
+    gServerData.MenuCache.Clear();
+    delete hSnapshot;
+}
+
+/**
+ * @brief Formats the cached menu line.
+ *
+ * @param clientIndex       The client index.
+ * @param iPlaying          The amount of playing players.
+ * @param iLimits           The amount of client purchases.
+ * @param bGroup            True if the group should be shown, false otherwise.
+ * @param lineData          The menu line data.
+ * @param sBuffer           The string to return line in.
+ * @param iMaxLen           The lenght of string.
+ **/
+void MenusFormatLine(int clientIndex, int iPlaying, int iLimits, bool bGroup, MenuLineData lineData, char[] sBuffer, int iMaxLen)
+{
+    FormatEx(sBuffer, iMaxLen, hasLength(lineData.Price) ? "%s  %s  %s" : "%s  %s", lineData.Name, bGroup ? lineData.Group : (gClientData[clientIndex].Level < lineData.Level) ? lineData.LevelInfo : (lineData.Limit && lineData.Limit <= iLimits) ? lineData.LimitInfo : (iPlaying < lineData.Online) ? lineData.OnlineInfo : "", lineData.Price);
+}
+
 /*
  * Menu main API.
  */
@@ -39,6 +39,19 @@
  * @endsection
  **/
 
+/**
+ * @section Class skill hook types.
+ **/
+enum
+{
+    SKILL_HOOK_USED,
+    SKILL_HOOK_OVER,
+    SKILL_HOOK_MAX
+};
+/**
+ * @endsection
+ **/
+ 
 /**
  * Arrays to store the skill bar.
  **/
@@ -194,6 +207,15 @@ void SkillSystemOnClientStart(int clientIndex)
         Action resultHandle; 
         gForwardData._OnClientSkillUsed(clientIndex, resultHandle);
         
+        // Block skill usage
+        if(resultHandle == Plugin_Handled || resultHandle == Plugin_Stop)
+        {
+            return;
+        }
+        
+        // Call class hook
+        SkillSystemOnClassHook(clientIndex, SKILL_HOOK_USED, resultHandle);
+        
         // Block skill usage
         if(resultHandle == Plugin_Handled || resultHandle == Plugin_Stop)
         {
@@ -291,6 +313,10 @@ public Action SkillSystemOnClientEnd(Handle hTimer, int userID)
         
         // Call forward
         gForwardData._OnClientSkillOver(clientIndex);
+        
+        // Call class hook
+        Action resultHandle;
+        SkillSystemOnClassHook(clientIndex, SKILL_HOOK_OVER, resultHandle);
     }
 
     // Destroy timer
@@ -397,6 +423,35 @@ public Action SkillSystemOnClientRegen(Handle hTimer, int userID)
     return Plugin_Stop;
 }
 
+/**
+ * @brief Calls the skill hook of the client class.
+ *
+ * @param clientIndex       The client index.
+ * @param iType             The hook type.
+ * @param resultHandle      The result of the hook.
+ **/
+void SkillSystemOnClassHook(int clientIndex, int iType, Action &resultHandle)
+{
+    // Validate class hooks
+    int iD = gClientData[clientIndex].Class;
+    if(iD >= gServerData.SkillHooks.Length)
+    {
+        return;
+    }
+    
+    // Validate any callback
+    Handle hForward = gServerData.SkillHooks.Get(iD, iType);
+    if(hForward == null || !GetForwardFunctionCount(hForward))
+    {
+        return;
+    }
+    
+    // Call forward
+    Call_StartForward(hForward);
+    Call_PushCell(clientIndex);
+    Call_Finish(resultHandle);
+}
+
 /*
  * Skill system natives API.
  */
@@ -409,6 +464,11 @@ void SkillSystemOnNativeInit(/*void*/)
     CreateNative("ZP_GetClientSkillUsage",     API_GetClientSkillUsage);
     CreateNative("ZP_GetClientSkillCountdown", API_GetClientSkillCountdown);
     CreateNative("ZP_ResetClientSkill",        API_ResetClientSkill);
+    CreateNative("ZP_HookClassSkillUsed",      API_HookClassSkillUsed);
+    CreateNative("ZP_HookClassSkillOver",      API_HookClassSkillOver);
+    
+    // Initialize a class hooks array
+    gServerData.SkillHooks = new ArrayList(SKILL_HOOK_MAX);
 }
 
 /**
@@ -455,4 +515,99 @@ public int API_ResetClientSkill(Handle hPlugin, int iNumParams)
     delete gClientData[clientIndex].CounterTimer;
     gClientData[clientIndex].Skill = false;
     gClientData[clientIndex].SkillCounter = 0.0;
+}
+
+/**
+ * @brief Binds a skill usage callback to the class.
+ *
+ * @note native int ZP_HookClassSkillUsed(iD, callback);
+ **/
+public int API_HookClassSkillUsed(Handle hPlugin, int iNumParams)
+{
+    // Gets class index from native cell
+    int iD = GetNativeCell(1);
+
+    // Validate index
+    if(iD < 0 || iD >= gServerData.Classes.Length)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Classes, "Native Validation", "Invalid the class index (%d)", iD);
+        return -1;
+    }
+    
+    // Bind callback
+    SkillSystemHookClass(iD, SKILL_HOOK_USED, hPlugin, GetNativeFunction(2));
+    
+    // Return on success
+    return iD;
+}
+
+/**
+ * @brief Binds a skill ending callback to the class.
+ *
+ * @note native int ZP_HookClassSkillOver(iD, callback);
+ **/
+public int API_HookClassSkillOver(Handle hPlugin, int iNumParams)
+{
+    // Gets class index from native cell
+    int iD = GetNativeCell(1);
+
+    // Validate index
+    if(iD < 0 || iD >= gServerData.Classes.Length)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Classes, "Native Validation", "Invalid the class index (%d)", iD);
+        return -1;
+    }
+    
+    // Bind callback
+    SkillSystemHookClass(iD, SKILL_HOOK_OVER, hPlugin, GetNativeFunction(2));
+    
+    // Return on success
+    return iD;
+}
+
+/*
+ * Stocks skill system API.
+ */
+
+/**
+ * @brief Binds a skill callback to the class.
+ *
+ * @param iD                The class index.
+ * @param iType             The hook type.
+ * @param hPlugin           The plugin handle.
+ * @param fCallback         The callback function.
+ **/
+void SkillSystemHookClass(int iD, int iType, Handle hPlugin, Function fCallback)
+{
+    // i = class index
+    int iSize = gServerData.SkillHooks.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Remove callback from the previous class (indexes can be changed on reload)
+        Handle hForward = gServerData.SkillHooks.Get(i, iType);
+        if(hForward != null)
+        {
+            RemoveFromForward(hForward, hPlugin, fCallback);
+        }
+    }
+    
+    // Expand array up to the class index
+    static Handle hEmpty[SKILL_HOOK_MAX];
+    while(iSize <= iD)
+    {
+        gServerData.SkillHooks.PushArray(hEmpty, sizeof(hEmpty));
+        iSize++;
+    }
+    
+    // Validate forward
+    Handle hForward = gServerData.SkillHooks.Get(iD, iType);
+    if(hForward == null)
+    {
+        // Creates a private forward
+        hForward = (iType == SKILL_HOOK_USED) ? CreateForward(ET_Hook, Param_Cell) : CreateForward(ET_Ignore, Param_Cell);
+        gServerData.SkillHooks.Set(iD, hForward, iType);
+    }
+    
+    // Adds the callback to the forward
+    AddToForward(hForward, hPlugin, fCallback);
 }
\ No newline at end of file
@@ -46,6 +46,40 @@ Address offsetSecondary;
 int SendProp_iBits; 
 int Player_CanBeSpotted;
 
+/**
+ * @section Number of valid transmit entities.
+ **/
+#define TOOLS_TRANSMIT_MAX 2048
+/**
+ * @endsection
+ **/
+
+/**
+ * @section Types of the transmit rules.
+ **/
+enum TransmitType
+{
+    TransmitType_Always,          /**  Transmit to everyone (unhooked) */
+    TransmitType_HideOwner,       /**  Hide from the owner and his first person observers */
+    TransmitType_OwnerOnly,       /**  Show only to the owner and his first person observers */
+    TransmitType_Zombies,         /**  Show only to zombies (by the zombie flag, same as !ZP_IsPlayerHuman) */
+    TransmitType_Humans           /**  Show only to humans (by the zombie flag, same as ZP_IsPlayerHuman) */
+};
+/**
+ * @endsection
+ **/
+
+/**
+ * @section Arrays to store the transmit rules and the client cache.
+ **/
+TransmitType ToolsTransmitRule[TOOLS_TRANSMIT_MAX];
+int ToolsTransmitView[MAXPLAYERS+1];
+int ToolsTransmitMask[MAXPLAYERS+1];
+int ToolsTransmitTick = -1;
+/**
+ * @endsection
+ **/
+
 // Tools Functions (header)
 #include "zp/manager/playerclasses/tools_functions.cpp"
 
@@ -217,6 +251,8 @@ void ToolsOnClientConnect(int clientIndex)
     // Forward event to modules
     gClientData[clientIndex].ResetVars();
     gClientData[clientIndex].ResetTimers();
+    ItemsRemoveLimits(clientIndex);
+    WeaponsRemoveLimits(clientIndex);
 }
 
 /**
@@ -231,23 +267,87 @@ void ToolsOnClientDisconnectPost(int clientIndex)
     gClientData[clientIndex].ResetTimers();
 }
 
+/**
+ * @brief Called when an entity is destroyed.
+ *
+ * @param entityIndex       The entity index.
+ **/
+void ToolsOnEntityDestroyed(int entityIndex)
+{
+    // Validate index
+    if(entityIndex > MaxClients && entityIndex < TOOLS_TRANSMIT_MAX)
+    {
+        // Clear the transmit rule
+        ToolsTransmitRule[entityIndex] = TransmitType_Always;
+    }
+}
+
 /**
  * Hook: SetTransmit
  * @brief Called right before the entity transmitting to other entities.
  *
+ * @note The one shared callback for all transmit rules of the entities.
+ *
  * @param entityIndex       The entity index.
  * @param clientIndex       The client index.
  **/
 public Action ToolsOnEntityTransmit(int entityIndex, int clientIndex)
 {
-    // Gets the owner of the entity
-    int ownerIndex = ToolsGetEntityOwner(entityIndex);
-
-    // Validate observer mode
-    if(ownerIndex == clientIndex || (ToolsGetClientObserverMode(clientIndex) == SPECMODE_FIRSTPERSON && ownerIndex == ToolsGetClientObserverTarget(clientIndex)))
+    // Allow entity to be transmittable
+    int iFlags = GetEdictFlags(entityIndex);
+    if(iFlags & FL_EDICT_ALWAYS)
     {
-        // Block transmitting
-        return Plugin_Handled;
+        SetEdictFlags(entityIndex, iFlags ^ FL_EDICT_ALWAYS);
+    }
+    
+    // Validate client cache
+    int iTick = GetGameTickCount();
+    if(ToolsTransmitTick != iTick)
+    {
+        // Update the cache once per tick
+        ToolsUpdateTransmit();
+        ToolsTransmitTick = iTick;
+    }
+    
+    // Gets the transmit rule
+    TransmitType nType = ToolsTransmitRule[entityIndex];
+    switch(nType)
+    {
+        case TransmitType_HideOwner :
+        {
+            // Gets the owner of the entity
+            int ownerIndex = ToolsGetEntityOwner(entityIndex);
+            
+            // Validate owner and observer view
+            if(ownerIndex == clientIndex || ownerIndex == ToolsTransmitView[clientIndex])
+            {
+                // Block transmitting
+                return Plugin_Handled;
+            }
+        }
+        
+        case TransmitType_OwnerOnly :
+        {
+            // Gets the owner of the entity
+            int ownerIndex = ToolsGetEntityOwner(entityIndex);
+            
+            // Validate owner and observer view
+            if(ownerIndex != clientIndex && ownerIndex != ToolsTransmitView[clientIndex])
+            {
+                // Block transmitting
+                return Plugin_Handled;
+            }
+        }
+        
+        case TransmitType_Zombies, TransmitType_Humans :
+        {
+            // Validate team
+            if(!(ToolsTransmitMask[clientIndex] & (1 << view_as<int>(nType))))
+            {
+                // Block transmitting
+                return Plugin_Handled;
+            }
+        }
     }
 
     // Allow transmitting
@@ -269,6 +369,7 @@ void ToolsOnNativeInit(/*void*/)
     CreateNative("ZP_LookupPoseParameter",  API_LookupPoseParameter);
     CreateNative("ZP_RespawnClient",        API_RespawnClient);
     CreateNative("ZP_FindPlayerInSphere",   API_FindPlayerInSphere);
+    CreateNative("ZP_SetEntityTransmit",    API_SetEntityTransmit);
 }
 
 /**
@@ -463,4 +564,38 @@ public int API_FindPlayerInSphere(Handle hPlugin, int iNumParams)
     
     // Return on the success
     return clientIndex;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Sets the transmit rule of the entity.
+ *
+ * @note native void ZP_SetEntityTransmit(entityIndex, type);
+ **/
+public int API_SetEntityTransmit(Handle hPlugin, int iNumParams)
+{
+    // Gets entity index from native cell
+    int entityIndex = GetNativeCell(1);
+
+    // Validate entity
+    if(entityIndex <= MaxClients || entityIndex >= TOOLS_TRANSMIT_MAX || !IsValidEdict(entityIndex))
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Tools, "Native Validation", "Invalid the entity index (%d)", entityIndex);
+        return -1;
+    }
+    
+    // Gets type from native cell
+    TransmitType nType = GetNativeCell(2);
+    
+    // Validate type
+    if(nType < TransmitType_Always || nType > TransmitType_Humans)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Tools, "Native Validation", "Invalid the transmit type (%d)", nType);
+        return -1;
+    }
+    
+    // Sets rule for the entity
+    ToolsSetEntityTransmit(entityIndex, nType);
+    
+    // Return on success
+    return entityIndex;
+}
@@ -45,6 +45,7 @@ void ToolsOnCvarInit(/*void*/)
     gCvarList[CVAR_MESSAGES_COUNTER]      = FindConVar("zp_messages_counter");
     gCvarList[CVAR_MESSAGES_BLAST]        = FindConVar("zp_messages_blast");
     gCvarList[CVAR_MESSAGES_DAMAGE]       = FindConVar("zp_messages_damage");
+    gCvarList[CVAR_MESSAGES_DAMAGE_DELAY] = FindConVar("zp_messages_damage_delay");
     gCvarList[CVAR_MESSAGES_DONATE]       = FindConVar("zp_messages_donate");
     gCvarList[CVAR_MESSAGES_CLASS_INFO]   = FindConVar("zp_messages_class_info");
     gCvarList[CVAR_MESSAGES_CLASS_CHOOSE] = FindConVar("zp_messages_class_choose");
@@ -864,6 +865,62 @@ void ToolsSetEntityOwner(int entityIndex, int ownerIndex)
     SetEntDataEnt2(entityIndex, g_iOffset_EntityOwnerEntity, ownerIndex, true);
 }
 
+/**
+ * @brief Sets the transmit rule of an entity.
+ * 
+ * @note All rules are evaluated in the one shared SetTransmit callback.
+ *
+ * @param entityIndex       The entity index.
+ * @param nType             The transmit type.
+ **/
+void ToolsSetEntityTransmit(int entityIndex, TransmitType nType)
+{
+    // Validate index
+    if(entityIndex <= MaxClients || entityIndex >= TOOLS_TRANSMIT_MAX)
+    {
+        return;
+    }
+    
+    // Validate hook
+    if(ToolsTransmitRule[entityIndex] == TransmitType_Always)
+    {
+        // Hook entity callbacks
+        if(nType != TransmitType_Always) SDKHook(entityIndex, SDKHook_SetTransmit, ToolsOnEntityTransmit);
+    }
+    else if(nType == TransmitType_Always)
+    {
+        // Unhook entity callbacks
+        SDKUnhook(entityIndex, SDKHook_SetTransmit, ToolsOnEntityTransmit);
+    }
+    
+    // Store the rule
+    ToolsTransmitRule[entityIndex] = nType;
+}
+
+/**
+ * @brief Updates the per-client cache used by the transmit rules.
+ **/
+void ToolsUpdateTransmit(/*void*/)
+{
+    // i = client index
+    for(int i = 1; i <= MaxClients; i++)
+    {
+        // Validate client
+        if(!IsClientInGame(i))
+        {
+            ToolsTransmitView[i] = i;
+            ToolsTransmitMask[i] = 0;
+            continue;
+        }
+        
+        // Store the first person observer target, or the client itself
+        ToolsTransmitView[i] = (ToolsGetClientObserverMode(i) == SPECMODE_FIRSTPERSON) ? ToolsGetClientObserverTarget(i) : i;
+        
+        // Store the team bits
+        ToolsTransmitMask[i] = 1 << view_as<int>(gClientData[i].Zombie ? TransmitType_Zombies : TransmitType_Humans);
+    }
+}
+
 /**
  * @brief Sets the team of an entity.
  * 
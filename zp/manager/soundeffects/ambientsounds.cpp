@@ -50,11 +50,13 @@ void AmbientSoundsOnGameModeStart(/*void*/)
         // Validate real client
         if(IsPlayerExist(i, false) && !IsFakeClient(i))
         {
-            // Start repeating timer
-            delete gClientData[i].AmbientTimer;
-            gClientData[i].AmbientTimer = CreateTimer(flAmbientDuration, AmbientSoundsOnMP3Repeat, GetClientUserId(i), TIMER_REPEAT | TIMER_FLAG_NO_MAPCHANGE);
+            // Schedule the replay
+            gClientData[i].AmbientTime = GetGameTime() + flAmbientDuration;
         }
     }
+    
+    // Start the shared audio tick
+    SoundsOnSchedule();
 }
 
 /**
@@ -90,49 +92,38 @@ void AmbientSoundsOnClientUpdate(int clientIndex)
     // Emit ambient sound
     SEffectsInputEmitToClient(ModesGetSoundAmbientID(gServerData.RoundMode), _, clientIndex, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarList[CVAR_SEFFECTS_LEVEL].IntValue, _, flAmbientVolume);
 
-    // Start repeating timer
-    delete gClientData[clientIndex].AmbientTimer;
-    gClientData[clientIndex].AmbientTimer = CreateTimer(flAmbientDuration, AmbientSoundsOnMP3Repeat, GetClientUserId(clientIndex), TIMER_REPEAT | TIMER_FLAG_NO_MAPCHANGE);
+    // Schedule the replay
+    gClientData[clientIndex].AmbientTime = GetGameTime() + flAmbientDuration;
+    SoundsOnSchedule();
 }
  
 /**
- * @brief Timer callback, replays ambient sound on a client.
+ * @brief Replays ambient sound on a client, when it is due.
+ *
+ * @note Called from the shared audio tick.
  *
- * @param hTimer            The timer handle.
- * @param userID            The user id.
+ * @param clientIndex       The client index.
  **/
-public Action AmbientSoundsOnMP3Repeat(Handle hTimer, int userID)
+void AmbientSoundsOnMP3Repeat(int clientIndex)
 {
-    // Gets client index from the user ID
-    int clientIndex = GetClientOfUserId(userID);
-
-    // Validate client
-    if(clientIndex)
-    {
-        // Gets ambient sound volume
-        float flAmbientVolume = ModesGetSoundVolume(gServerData.RoundMode);
-        if(!flAmbientVolume || !ModesGetSoundDuration(gServerData.RoundMode))
-        {
-            // Clear timer
-            gClientData[clientIndex].AmbientTimer = null;
-    
-            // Destroy timer
-            return Plugin_Stop;
-        }
+    // Gets ambient sound duration
+    float flAmbientDuration = ModesGetSoundDuration(gServerData.RoundMode);
     
-        // Stop sound before playing again
-        SEffectsInputStopSound(ModesGetSoundAmbientID(gServerData.RoundMode), clientIndex, SNDCHAN_STATIC);
+    // Gets ambient sound volume
+    float flAmbientVolume = ModesGetSoundVolume(gServerData.RoundMode);
+    if(!flAmbientVolume || !flAmbientDuration)
+    {
+        // Clear the schedule
+        gClientData[clientIndex].AmbientTime = 0.0;
+        return;
+    }
 
-        // Emit ambient sound
-        SEffectsInputEmitToClient(ModesGetSoundAmbientID(gServerData.RoundMode), _, clientIndex, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarList[CVAR_SEFFECTS_LEVEL].IntValue, _, flAmbientVolume);
+    // Stop sound before playing again
+    SEffectsInputStopSound(ModesGetSoundAmbientID(gServerData.RoundMode), clientIndex, SNDCHAN_STATIC);
 
-        // Allow timer
-        return Plugin_Continue;
-    }
+    // Emit ambient sound
+    SEffectsInputEmitToClient(ModesGetSoundAmbientID(gServerData.RoundMode), _, clientIndex, SOUND_FROM_PLAYER, SNDCHAN_STATIC, gCvarList[CVAR_SEFFECTS_LEVEL].IntValue, _, flAmbientVolume);
 
-    // Clear timer
-    gClientData[clientIndex].AmbientTimer = null;
-    
-    // Destroy timer
-    return Plugin_Stop;
-}
\ No newline at end of file
+    // Schedule the next replay
+    gClientData[clientIndex].AmbientTime = GetGameTime() + flAmbientDuration;
+}
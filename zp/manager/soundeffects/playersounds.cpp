@@ -25,6 +25,19 @@
  * ============================================================================
  **/
  
+/**
+ * @section Types of the engine sound samples.
+ **/
+enum SampleType
+{
+    SampleType_Other,
+    SampleType_Footstep,
+    SampleType_Knife
+};
+/**
+ * @endsection
+ **/
+ 
 /**
  * @section Struct of sounds used by the plugin.
  **/
@@ -37,6 +50,7 @@ enum struct SoundData
     int Start;
     int Count;
     int Blast;
+    StringMap Samples;
 }
 /**
  * @endsection
@@ -82,6 +96,18 @@ void PlayerSoundsOnOnLoad(/*void*/)
     // Load round blast sounds
     gCvarList[CVAR_SEFFECTS_ROUND_BLAST].GetString(sBuffer, sizeof(sBuffer));
     gSoundData.Blast = SoundsKeyToIndex(sBuffer);
+    
+    // Validate samples cache
+    if(gSoundData.Samples == null)
+    {
+        // Create the samples cache
+        gSoundData.Samples = new StringMap();
+    }
+    else
+    {
+        // Clear the samples of the previous map
+        gSoundData.Samples.Clear();
+    }
 }
 
 /**
@@ -266,37 +292,34 @@ void PlayerSoundsOnClientInfected(int clientIndex, int attackerIndex)
         return;
     }
 
-    // Start repeating timer
-    delete gClientData[clientIndex].MoanTimer;
-    gClientData[clientIndex].MoanTimer = CreateTimer(flInterval, PlayerSoundsOnMoanRepeat, GetClientUserId(clientIndex), TIMER_REPEAT | TIMER_FLAG_NO_MAPCHANGE);
+    // Schedule the moan
+    gClientData[clientIndex].MoanTime = GetGameTime() + flInterval;
+    SoundsOnSchedule();
 }
 
 /**
- * @brief Timer callback, repeats a moaning sound on zombies.
+ * @brief Repeats a moaning sound on a zombie, when it is due.
  * 
- * @param hTimer            The timer handle.
- * @param userID            The user id.
+ * @note Called from the shared audio tick.
+ *
+ * @param clientIndex       The client index.
  **/
-public Action PlayerSoundsOnMoanRepeat(Handle hTimer, int userID)
+void PlayerSoundsOnMoanRepeat(int clientIndex)
 {
-    // Gets client index from the user ID
-    int clientIndex = GetClientOfUserId(userID);
-
-    // Validate client
-    if(clientIndex)
+    // If interval is set to 0, then stop
+    float flInterval = gCvarList[CVAR_SEFFECTS_MOAN].FloatValue;
+    if(!flInterval)
     {
-        // Emit moan sound
-        SEffectsInputEmitToAll(ClassGetSoundIdleID(gClientData[clientIndex].Class), _, clientIndex, SNDCHAN_STATIC, gCvarList[CVAR_SEFFECTS_LEVEL].IntValue);
-
-        // Allow timer
-        return Plugin_Continue;
+        // Clear the schedule
+        gClientData[clientIndex].MoanTime = 0.0;
+        return;
     }
-
-    // Clear timer
-    gClientData[clientIndex].MoanTimer = null;
     
-    // Destroy timer
-    return Plugin_Stop;
+    // Emit moan sound
+    SEffectsInputEmitToAll(ClassGetSoundIdleID(gClientData[clientIndex].Class), _, clientIndex, SNDCHAN_STATIC, gCvarList[CVAR_SEFFECTS_LEVEL].IntValue);
+
+    // Schedule the next moan
+    gClientData[clientIndex].MoanTime = GetGameTime() + flInterval;
 }
 
 /**
@@ -393,37 +416,49 @@ bool PlayerSoundsOnClientShoot(int clientIndex, int iD)
  **/ 
 public Action PlayerSoundsNormalHook(int clients[MAXPLAYERS-1], int &numClients, char[] sSample, int &entityIndex, int &iChannel, float &flVolume, int &iLevel, int &iPitch, int &iFrags)
 {
+    // Gets the cached type of the sample
+    SampleType nType = PlayerSoundsGetSampleType(sSample);
+    if(nType == SampleType_Other)
+    {
+        // Allow sounds
+        return Plugin_Continue;
+    }
+    
     // Gets real player index from event key 
     int clientIndex = (IsValidEdict(entityIndex) && WeaponsValidateKnife(entityIndex)) ? WeaponsGetOwner(entityIndex) : entityIndex;
 
     // Validate client
     if(IsPlayerExist(clientIndex))
     {
-        // If a footstep sound, then proceed
-        if(StrContains(sSample, "footsteps", false) != -1)
+        switch(nType)
         {
-            // If footstep sounds disabled, then stop
-            if(gCvarList[CVAR_SEFFECTS_FOOTSTEPS].BoolValue) 
+            // If a footstep sound, then proceed
+            case SampleType_Footstep :
             {
-                // Emit footstep sound
-                if(SEffectsInputEmitToAll(ClassGetSoundFootID(gClientData[clientIndex].Class), _, clientIndex, SNDCHAN_STREAM, gCvarList[CVAR_SEFFECTS_LEVEL].IntValue))
+                // If footstep sounds disabled, then stop
+                if(gCvarList[CVAR_SEFFECTS_FOOTSTEPS].BoolValue) 
                 {
-                    // Block sounds
-                    return Plugin_Stop; 
+                    // Emit footstep sound
+                    if(SEffectsInputEmitToAll(ClassGetSoundFootID(gClientData[clientIndex].Class), _, clientIndex, SNDCHAN_STREAM, gCvarList[CVAR_SEFFECTS_LEVEL].IntValue))
+                    {
+                        // Block sounds
+                        return Plugin_Stop; 
+                    }
                 }
             }
-        }
-        // If a knife sound, then proceed
-        else if(StrContains(sSample, "knife", false) != -1)
-        {
-            // If attack sounds disabled, then stop
-            if(gCvarList[CVAR_SEFFECTS_CLAWS].BoolValue) 
+            
+            // If a knife sound, then proceed
+            case SampleType_Knife :
             {
-                // Emit slash sound
-                if(SEffectsInputEmitToAll(ClassGetSoundAttackID(gClientData[clientIndex].Class), _, entityIndex, SNDCHAN_WEAPON, gCvarList[CVAR_SEFFECTS_LEVEL].IntValue))
+                // If attack sounds disabled, then stop
+                if(gCvarList[CVAR_SEFFECTS_CLAWS].BoolValue) 
                 {
-                    // Block sounds
-                    return Plugin_Stop; 
+                    // Emit slash sound
+                    if(SEffectsInputEmitToAll(ClassGetSoundAttackID(gClientData[clientIndex].Class), _, entityIndex, SNDCHAN_WEAPON, gCvarList[CVAR_SEFFECTS_LEVEL].IntValue))
+                    {
+                        // Block sounds
+                        return Plugin_Stop; 
+                    }
                 }
             }
         }
@@ -433,6 +468,48 @@ public Action PlayerSoundsNormalHook(int clients[MAXPLAYERS-1], int &numClients,
     return Plugin_Continue;
 }
 
+/**
+ * @brief Gets the type of the engine sound sample.
+ *
+ * @note The samples are classified once on the first sight and cached by the path.
+ *
+ * @param sSample           The sample path.
+ * @return                  The sample type.
+ **/
+SampleType PlayerSoundsGetSampleType(const char[] sSample)
+{
+    // Validate samples cache
+    if(gSoundData.Samples == null)
+    {
+        return SampleType_Other;
+    }
+    
+    // Gets the cached type
+    SampleType nType;
+    if(gSoundData.Samples.GetValue(sSample, nType))
+    {
+        return nType;
+    }
+    
+    // Classify the sample
+    if(StrContains(sSample, "footsteps", false) != -1)
+    {
+        nType = SampleType_Footstep;
+    }
+    else if(StrContains(sSample, "knife", false) != -1)
+    {
+        nType = SampleType_Knife;
+    }
+    else
+    {
+        nType = SampleType_Other;
+    }
+    
+    // Store the type
+    gSoundData.Samples.SetValue(sSample, nType);
+    return nType;
+}
+
 /**
  * Cvar hook callback (zp_seffects_player_*, zp_seffects_round_*)
  * @brief Load the sound variables.
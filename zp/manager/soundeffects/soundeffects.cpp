@@ -54,11 +54,8 @@ bool SEffectsInputEmitToAll(int iKey, int iNum = 0, int entityIndex = SOUND_FROM
     // Validate sound
     if(hasLength(sSound))
     {
-        // Format sound
-        Format(sSound, sizeof(sSound), "*/%s", sSound);
-
         // Emit sound
-        EmitSoundToAll(sSound, entityIndex, iChannel, iLevel, iFlags, flVolume, iPitch, speakerIndex, vPosition, vDirection, updatePos, flSoundTime);
+        SEffectsEmitToAudible(sSound, entityIndex, iChannel, iLevel, iFlags, flVolume, iPitch, speakerIndex, vPosition, vDirection, updatePos, flSoundTime, SoundsGetDistance(iKey));
         return true;
     }
 
@@ -66,6 +63,178 @@ bool SEffectsInputEmitToAll(int iKey, int iNum = 0, int entityIndex = SOUND_FROM
     return false;
 }
 
+/**
+ * @brief Emits a sound to the clients, which are able to hear it.
+ *
+ * @param sSound            The sound path.
+ * @param entityIndex       (Optional) The entity to emit from.
+ * @param iChannel          (Optional) The channel to emit with.
+ * @param iLevel            (Optional) The sound level.
+ * @param iFlags            (Optional) The sound flags.
+ * @param flVolume          (Optional) The sound volume.
+ * @param iPitch            (Optional) The sound pitch.
+ * @param speakerIndex      (Optional) Unknown.
+ * @param vPosition         (Optional) The sound origin.
+ * @param vDirection        (Optional) The sound direction.
+ * @param updatePos         (Optional) Unknown (updates positions?)
+ * @param flSoundTime       (Optional) Alternate time to play sound for.
+ * @param flDistance        (Optional) The audible distance. (-1.0 = by sound level, 0.0 = unlimited)
+ * @return                  The amount of the recipients.
+ **/
+int SEffectsEmitToAudible(char[] sSound, int entityIndex = SOUND_FROM_PLAYER, int iChannel = SNDCHAN_AUTO, int iLevel = SNDLEVEL_NORMAL, int iFlags = SND_NOFLAGS, float flVolume = SNDVOL_NORMAL, int iPitch = SNDPITCH_NORMAL, int speakerIndex = INVALID_ENT_REFERENCE, float vPosition[3] = NULL_VECTOR, float vDirection[3] = NULL_VECTOR, bool updatePos = true, float flSoundTime = 0.0, float flDistance = -1.0)
+{
+    // Gets the audible clients
+    int[] clients = new int[MaxClients]; 
+    int iCount = SEffectsGetAudibleClients(entityIndex, vPosition, iLevel, flDistance, clients);
+    
+    // Validate recipients
+    if(iCount)
+    {
+        // Emit sound
+        EmitSound(clients, iCount, sSound, entityIndex, iChannel, iLevel, iFlags, flVolume, iPitch, speakerIndex, vPosition, vDirection, updatePos, flSoundTime);
+    }
+    
+    // Return on success
+    return iCount;
+}
+
+/**
+ * @brief Gets the clients, which are able to hear the sound.
+ *
+ * @note The audible distance is taken from the sound level attenuation, like the engine 
+ *       does it (1000 / attn), and scaled with the cull cvar.
+ *       Without culling all in-game clients are returned, like EmitSoundToAll does.
+ *       With culling bots are skipped, but SourceTV and replay clients are always kept.
+ *       The origin is used for culling only, if the sound isn't emitted from an entity.
+ *
+ * @param entityIndex       The entity to emit from.
+ * @param vSource           The sound origin.
+ * @param iLevel            The sound level.
+ * @param flDistance        The audible distance. (-1.0 = by sound level, 0.0 = unlimited)
+ * @param clients           The array to store the clients in.
+ * @return                  The amount of the clients.
+ **/
+int SEffectsGetAudibleClients(int entityIndex, const float vSource[3], int iLevel, float flDistance, int[] clients)
+{
+    // Gets the cull ratio
+    float flRatio = gCvarList[CVAR_SEFFECTS_CULL].FloatValue;
+    
+    // Validate the distance by sound level
+    if(flDistance < 0.0)
+    {
+        // Calculate distance from the attenuation (none for SNDLEVEL_NONE)
+        flDistance = iLevel ? (iLevel > 50 ? 50.0 * float(iLevel - 50) : 250.0) * flRatio : 0.0;
+    }
+    
+    // Initialize vector variables
+    static float vPosition[3];
+    
+    // Validate distance
+    bool bCull = (flRatio > 0.0 && flDistance > 0.0);
+    if(bCull)
+    {
+        // Validate entity
+        if(entityIndex > 0 && IsValidEdict(entityIndex))
+        {
+            // Gets source position
+            GetEntPropVector(entityIndex, Prop_Data, "m_vecAbsOrigin", vPosition);
+        }
+        // Validate origin
+        else if(!IsNullVector(vSource))
+        {
+            // Gets sound position
+            vPosition[0] = vSource[0];
+            vPosition[1] = vSource[1];
+            vPosition[2] = vSource[2];
+        }
+        else
+        {
+            // Nowhere to measure from
+            bCull = false;
+        }
+        
+        // Square the distance
+        flDistance *= flDistance;
+    }
+    
+    // Gets the potentially audible clients
+    int iCount; static int iPAS[MAXPLAYERS+1];
+    int iSize = (bCull && gCvarList[CVAR_SEFFECTS_CULL_PAS].BoolValue) ? GetClientsInRange(vPosition, RangeType_Audibility, iPAS, MaxClients) : -1;
+    
+    // i = client index
+    for(int i = 1; i <= MaxClients; i++)
+    {
+        // Validate client
+        if(!IsClientInGame(i))
+        {
+            continue;
+        }
+        
+        // Validate culling
+        if(bCull && i != entityIndex)
+        {
+            // Validate the demo recorders (always receive sounds as with EmitSoundToAll)
+            if(IsClientSourceTV(i) || IsClientReplay(i))
+            {
+                clients[iCount++] = i;
+                continue;
+            }
+            
+            // Validate real client
+            if(IsFakeClient(i))
+            {
+                continue;
+            }
+            
+            // Gets client position
+            static float vOrigin[3];
+            ToolsGetClientAbsOrigin(i, vOrigin);
+            
+            // Validate range
+            if(GetVectorDistance(vPosition, vOrigin, true) > flDistance)
+            {
+                continue;
+            }
+            
+            // Validate audible set
+            if(iSize != -1 && !SEffectsFindClient(iPAS, iSize, i))
+            {
+                continue;
+            }
+        }
+        
+        // Store the client
+        clients[iCount++] = i;
+    }
+    
+    // Return on success
+    return iCount;
+}
+
+/**
+ * @brief Finds the client in the list.
+ *
+ * @param clients           The array of the clients.
+ * @param iSize             The amount of the clients.
+ * @param clientIndex       The client index.
+ * @return                  True if the client is in the list, false otherwise.
+ **/
+bool SEffectsFindClient(int[] clients, int iSize, int clientIndex)
+{
+    // i = array index
+    for(int i = 0; i < iSize; i++)
+    {
+        // Validate client
+        if(clients[i] == clientIndex)
+        {
+            return true;
+        }
+    }
+    
+    // Client doesn't exist
+    return false;
+}
+
 /**
  * @brief Emits a sound to the client.
  *
@@ -96,9 +265,6 @@ bool SEffectsInputEmitToClient(int iKey, int iNum = 0, int clientIndex, int enti
     // Validate sound
     if(hasLength(sSound))
     {
-        // Format sound
-        Format(sSound, sizeof(sSound), "*/%s", sSound);
-
         // Emit sound
         EmitSoundToClient(clientIndex, sSound, entityIndex, iChannel, iLevel, iFlags, flVolume, iPitch, speakerIndex, vPosition, vDirection, updatePos, flSoundTime);
         return true;
@@ -133,9 +299,6 @@ bool SEffectsInputEmitAmbient(int iKey, int iNum = 0, float vPosition[3], int en
     // Validate sound
     if(hasLength(sSound))
     {
-        // Format sound
-        Format(sSound, sizeof(sSound), "*/%s", sSound);
-
         // Emit sound
         EmitAmbientSound(sSound, vPosition, entityIndex, iLevel, iFlags, flVolume, iPitch, flDelay);
         return true;
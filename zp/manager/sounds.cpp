@@ -37,6 +37,14 @@ enum
  * @endsection
  **/
  
+/**
+ * @section Number of valid duplicates of the sound key.
+ **/
+#define SOUNDS_KEY_DUPLICATES 64
+/**
+ * @endsection
+ **/
+ 
 /*
  * Load other sound effect modules
  */
@@ -50,8 +58,12 @@ enum
  **/
 void SoundsOnInit(/*void*/)
 {
-    // Hooks server sounds
-    AddNormalSoundHook(view_as<NormalSHook>(PlayerSoundsNormalHook));
+    // Hooks server sounds (the only normal sound hook of the core)
+    AddNormalSoundHook(view_as<NormalSHook>(SoundsNormalHook));
+    
+    // Create the key index
+    gServerData.SoundKeys = new StringMap();
+    gServerData.SoundDistances = new ArrayList();
 }
 
 /**
@@ -124,6 +136,9 @@ void SoundsOnCacheData(/*void*/)
         return;
     }
     
+    // Clear the distance overrides
+    gServerData.SoundDistances.Clear();
+    
     // i = sound array index
     for(int i = 0; i < iSounds; i++)
     {
@@ -133,19 +148,40 @@ void SoundsOnCacheData(/*void*/)
         // Parses a parameter string in key="value" format
         if(ParamParseString(arraySound, sPathSounds, sizeof(sPathSounds), '=') == PARAM_ERROR_NO)
         {
+            // Initialize the audible distance (by sound level)
+            float flDistance = -1.0;
+        
             // i = block index
             int iSize = arraySound.Length;
             for(int x = 1; x < iSize; x++)
             {
                 // Gets sound path
                 arraySound.GetString(x, sPathSounds, sizeof(sPathSounds));
+                
+                // Validate the distance override
+                float flValue;
+                if(hasLength(sPathSounds) && StringToFloatEx(sPathSounds, flValue) == strlen(sPathSounds))
+                {
+                    // Remove it from the sound list
+                    flDistance = flValue;
+                    arraySound.Erase(x);
+                    iSize--; x--;
+                    continue;
+                }
 
                 // Format the full path
                 Format(sPathSounds, sizeof(sPathSounds), "sound/%s", sPathSounds);
 
                 // Add to server precache list
                 if(DownloadsOnPrecache(sPathSounds)) iSoundValidCount++; else iSoundUnValidCount++;
+                
+                // Store the ready to emit path ("sound/" -> "*/")
+                ReplaceStringEx(sPathSounds, sizeof(sPathSounds), "sound", "*", 5, 1, true);
+                arraySound.SetString(x, sPathSounds);
             }
+            
+            // Store the audible distance
+            gServerData.SoundDistances.Push(flDistance);
         }
         else
         {
@@ -165,6 +201,45 @@ void SoundsOnCacheData(/*void*/)
     
     // Log sound validation info
     LogEvent(true, LogType_Normal, LOG_DEBUG_DETAIL, LogModule_Sounds, "Config Validation", "Total blocks: \"%d\" | Unsuccessful blocks: \"%d\" | Total: %d | Successful: \"%d\" | Unsuccessful: \"%d\"", iSoundCount, iSoundCount - iSounds, iSoundValidCount + iSoundUnValidCount, iSoundValidCount, iSoundUnValidCount);
+    
+    // Create the key index
+    SoundsOnCacheKeys();
+}
+
+/**
+ * @brief Caches the blocks of each sound key into the key index.
+ **/
+void SoundsOnCacheKeys(/*void*/)
+{
+    // Clear the key index
+    gServerData.SoundKeys.Clear();
+    
+    // Initialize variables
+    static char sKey[SMALL_LINE_LENGTH]; static int keyIndex[SOUNDS_KEY_DUPLICATES];
+    
+    // i = block index
+    int iSize = gServerData.Sounds.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Gets sound key in lower case
+        SoundsGetKey(i, sKey, sizeof(sKey));
+        StringToLower(sKey);
+        
+        // Gets the blocks of the key
+        int iCount;
+        gServerData.SoundKeys.GetArray(sKey, keyIndex, sizeof(keyIndex), iCount);
+        
+        // Validate amount
+        if(iCount >= sizeof(keyIndex))
+        {
+            LogEvent(false, LogType_Error, LOG_GAME_EVENTS, LogModule_Sounds, "Config Validation", "Too many blocks with the same key: \"%s\" (Max %d)", sKey, sizeof(keyIndex));
+            continue;
+        }
+        
+        // Store the block
+        keyIndex[iCount++] = i;
+        gServerData.SoundKeys.SetArray(sKey, keyIndex, iCount);
+    }
 }
 
 /**
@@ -184,7 +259,9 @@ public void SoundsOnConfigReload(ConfigFile iConfig)
 void SoundsOnCvarInit(/*void*/)
 {
     // Create cvars
-    gCvarList[CVAR_SEFFECTS_LEVEL] = FindConVar("zp_seffects_level");
+    gCvarList[CVAR_SEFFECTS_LEVEL]    = FindConVar("zp_seffects_level");
+    gCvarList[CVAR_SEFFECTS_CULL]     = FindConVar("zp_seffects_cull");
+    gCvarList[CVAR_SEFFECTS_CULL_PAS] = FindConVar("zp_seffects_cull_pas");
     
     // Forward event to sub-modules
     VoiceOnCvarInit();
@@ -261,6 +338,82 @@ void SoundsOnGameModeStart(/*void*/)
     AmbientSoundsOnGameModeStart();
 }
 
+/**
+ * @brief Starts the shared audio tick, if it isn't running yet.
+ **/
+void SoundsOnSchedule(/*void*/)
+{
+    // Validate timer
+    if(gServerData.AudioTimer == null)
+    {
+        gServerData.AudioTimer = CreateTimer(0.1, SoundsOnAudioTick, _, TIMER_REPEAT | TIMER_FLAG_NO_MAPCHANGE);
+    }
+}
+
+/**
+ * @brief Timer callback, plays the due ambient and moan sounds of all clients.
+ *
+ * @note The one timer replaces the per client repeating timers,
+ *       and stops itself when nothing is scheduled.
+ * 
+ * @param hTimer            The timer handle.
+ **/
+public Action SoundsOnAudioTick(Handle hTimer)
+{
+    // Gets current time
+    float flTime = GetGameTime();
+    
+    // Initialize the state
+    bool bActive;
+    
+    // i = client index
+    for(int i = 1; i <= MaxClients; i++)
+    {
+        // Validate any schedule
+        if(!gClientData[i].AmbientTime && !gClientData[i].MoanTime)
+        {
+            continue;
+        }
+        
+        // Validate client
+        if(!IsClientInGame(i))
+        {
+            // Clear the schedule
+            gClientData[i].AmbientTime = 0.0;
+            gClientData[i].MoanTime = 0.0;
+            continue;
+        }
+        
+        // Validate the due ambient
+        if(gClientData[i].AmbientTime > 0.0 && flTime >= gClientData[i].AmbientTime)
+        {
+            AmbientSoundsOnMP3Repeat(i);
+        }
+        
+        // Validate the due moan
+        if(gClientData[i].MoanTime > 0.0 && flTime >= gClientData[i].MoanTime)
+        {
+            PlayerSoundsOnMoanRepeat(i);
+        }
+        
+        // Keep the tick while anything is scheduled
+        if(gClientData[i].AmbientTime > 0.0 || gClientData[i].MoanTime > 0.0) bActive = true;
+    }
+    
+    // Validate state
+    if(bActive)
+    {
+        // Allow timer
+        return Plugin_Continue;
+    }
+    
+    // Clear timer
+    gServerData.AudioTimer = null;
+    
+    // Destroy timer
+    return Plugin_Stop;
+}
+
 /**
  * @brief Client has been killed.
  * 
@@ -386,6 +539,60 @@ Action SoundsOnClientShoot(int clientIndex, int iD)
     return PlayerSoundsOnClientShoot(clientIndex, iD) ? Plugin_Stop : Plugin_Continue;
 }
 
+/**
+ * Sound hook callback.
+ * @brief Routes the sound to the weapon hooks and the player sounds.
+ * 
+ * @param clients           Array of client indexes.
+ * @param numClients        Number of clients in the array (modify this value if you add/remove elements from the client array).
+ * @param sSample           Sound file name relative to the "sounds" folder.
+ * @param entityIndex       Entity emitting the sound.
+ * @param iChannel          Channel emitting the sound.
+ * @param flVolume          The sound volume.
+ * @param iLevel            The sound level.
+ * @param iPitch            The sound pitch.
+ * @param iFlags            The sound flags.
+ **/ 
+public Action SoundsNormalHook(int clients[MAXPLAYERS-1], int &numClients, char[] sSample, int &entityIndex, int &iChannel, float &flVolume, int &iLevel, int &iPitch, int &iFlags)
+{
+    // Validate entity
+    if(IsValidEdict(entityIndex))
+    {
+        // Validate weapon hooks
+        int iD = WeaponsGetCustomID(entityIndex);
+        if(iD >= 0 && iD < gServerData.SoundHooks.Length)
+        {
+            // Validate any callback
+            Handle hForward = gServerData.SoundHooks.Get(iD);
+            if(hForward != null && GetForwardFunctionCount(hForward))
+            {
+                // Call forward
+                Action resultHandle;
+                Call_StartForward(hForward);
+                Call_PushArrayEx(clients, sizeof(clients), SM_PARAM_COPYBACK);
+                Call_PushCellRef(numClients);
+                Call_PushStringEx(sSample, PLATFORM_MAX_PATH, SM_PARAM_STRING_COPY, SM_PARAM_COPYBACK);
+                Call_PushCellRef(entityIndex);
+                Call_PushCellRef(iChannel);
+                Call_PushFloatRef(flVolume);
+                Call_PushCellRef(iLevel);
+                Call_PushCellRef(iPitch);
+                Call_PushCellRef(iFlags);
+                Call_Finish(resultHandle);
+                
+                // Validate result
+                if(resultHandle != Plugin_Continue)
+                {
+                    return resultHandle;
+                }
+            }
+        }
+    }
+    
+    // Forward event to sub-modules
+    return PlayerSoundsNormalHook(clients, numClients, sSample, entityIndex, iChannel, flVolume, iLevel, iPitch, iFlags);
+}
+
 /*
  * Sounds natives API.
  */
@@ -400,6 +607,11 @@ void SoundsOnNativeInit(/*void*/)
     CreateNative("ZP_EmitSoundToAll",    API_EmitSoundToAll);
     CreateNative("ZP_EmitSoundToClient", API_EmitSoundToClient);
     CreateNative("ZP_EmitAmbientSound",  API_EmitAmbientSound);
+    CreateNative("ZP_EmitSoundToAudible", API_EmitSoundToAudible);
+    CreateNative("ZP_HookWeaponSound",   API_HookWeaponSound);
+    
+    // Initialize a weapon hooks array
+    gServerData.SoundHooks = new ArrayList();
 }
  
 /**
@@ -451,13 +663,6 @@ public int API_GetSound(Handle hPlugin, int iNumParams)
     // Gets sound path
     SoundsGetPath(GetNativeCell(1), sSound, sizeof(sSound), GetNativeCell(4));
     
-    // Validate sound
-    if(hasLength(sSound))
-    {
-        // Format sound
-        Format(sSound, sizeof(sSound), "*/%s", sSound);
-    }
-    
     // Return on success
     return SetNativeString(2, sSound, maxLen);
 }
@@ -498,11 +703,102 @@ public int API_EmitAmbientSound(Handle hPlugin, int iNumParams)
     // Play sound
     return SEffectsInputEmitAmbient(GetNativeCell(1), GetNativeCell(2), vPosition, GetNativeCell(4), GetNativeCell(5), GetNativeCell(6), GetNativeCell(7), GetNativeCell(8), GetNativeCell(9));
 }
+
+/**
+ * @brief Emits a sound to the clients, which are able to hear it.
+ *
+ * @note native int ZP_EmitSoundToAudible(sample, entity, channel, level, flags, volume, pitch, origin);
+ **/
+public int API_EmitSoundToAudible(Handle hPlugin, int iNumParams)
+{
+    // Initialize sound char
+    static char sSound[PLATFORM_LINE_LENGTH];
+    GetNativeString(1, sSound, sizeof(sSound));
+    
+    // Validate origin
+    if(!IsNativeParamNullVector(8))
+    {
+        // Gets origin vector
+        static float vPosition[3];
+        GetNativeArray(8, vPosition, sizeof(vPosition));
+        
+        // Play sound
+        return SEffectsEmitToAudible(sSound, GetNativeCell(2), GetNativeCell(3), GetNativeCell(4), GetNativeCell(5), GetNativeCell(6), GetNativeCell(7), _, vPosition);
+    }
+    
+    // Play sound
+    return SEffectsEmitToAudible(sSound, GetNativeCell(2), GetNativeCell(3), GetNativeCell(4), GetNativeCell(5), GetNativeCell(6), GetNativeCell(7));
+}
+
+/**
+ * @brief Binds a normal sound callback to the weapon.
+ *
+ * @note native void ZP_HookWeaponSound(iD, callback);
+ **/
+public int API_HookWeaponSound(Handle hPlugin, int iNumParams)
+{
+    // Gets weapon index from native cell
+    int iD = GetNativeCell(1);
+
+    // Validate index
+    if(iD < 0 || iD >= gServerData.Weapons.Length)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Sounds, "Native Validation", "Invalid the weapon index (%d)", iD);
+        return -1;
+    }
+    
+    // Bind callback
+    SoundsHookWeapon(iD, hPlugin, GetNativeFunction(2));
+    
+    // Return on success
+    return iD;
+}
  
 /*
  * Sounds data reading API. 
  */
 
+/**
+ * @brief Binds a normal sound callback to the weapon.
+ *
+ * @param iD                The weapon index.
+ * @param hPlugin           The plugin handle.
+ * @param fCallback         The callback function.
+ **/
+void SoundsHookWeapon(int iD, Handle hPlugin, Function fCallback)
+{
+    // i = weapon index
+    int iSize = gServerData.SoundHooks.Length;
+    for(int i = 0; i < iSize; i++)
+    {
+        // Remove callback from the previous weapon (indexes can be changed on reload)
+        Handle hForward = gServerData.SoundHooks.Get(i);
+        if(hForward != null)
+        {
+            RemoveFromForward(hForward, hPlugin, fCallback);
+        }
+    }
+    
+    // Expand array up to the weapon index
+    while(iSize <= iD)
+    {
+        gServerData.SoundHooks.Push(INVALID_HANDLE);
+        iSize++;
+    }
+    
+    // Validate forward
+    Handle hForward = gServerData.SoundHooks.Get(iD);
+    if(hForward == null)
+    {
+        // Creates a private forward
+        hForward = CreateForward(ET_Hook, Param_Array, Param_CellByRef, Param_String, Param_CellByRef, Param_CellByRef, Param_FloatByRef, Param_CellByRef, Param_CellByRef, Param_CellByRef);
+        gServerData.SoundHooks.Set(iD, hForward);
+    }
+    
+    // Adds the callback to the forward
+    AddToForward(hForward, hPlugin, fCallback);
+}
+
 /**
  * @brief Gets the key of a sound list at a given key.
  * 
@@ -528,6 +824,8 @@ ArrayList SoundsGetKey(int iKey, char[] sKey, int iMaxLen, bool bDelete = false)
  
 /**
  * @brief Gets the path of a sound list at a given key.
+ *
+ * @note The path is already formatted for emitting (with the fake precache prefix).
  * 
  * @param iKey              The sound array index.
  * @param sPath             The string to return name in.
@@ -554,6 +852,24 @@ void SoundsGetPath(int iKey, char[] sPath, int iMaxLen, int iNum = 0)
     }
 }
 
+/**
+ * @brief Gets the audible distance of a sound list at a given key.
+ * 
+ * @param iKey              The sound array index.
+ * @return                  The distance override, or -1.0 to use the sound level.
+ **/
+float SoundsGetDistance(int iKey)
+{
+    // Validate key
+    if(iKey == -1)
+    {
+        return -1.0;
+    }
+    
+    // Return the value
+    return gServerData.SoundDistances.Get(iKey);
+}
+
 /**
  * @brief Stops a sound list at a given key.
  * 
@@ -585,9 +901,6 @@ void SoundsStopAll(int iKey, int clientIndex = -1, int iChannel = SNDCHAN_AUTO)
         // Validate sound
         if(hasLength(sSound))
         {
-            // Format sound
-            Format(sSound, sizeof(sSound), "*/%s", sSound);
-            
             // Validate client
             if(IsPlayerExist(clientIndex, false) && !IsFakeClient(clientIndex))
             {
@@ -623,26 +936,22 @@ void SoundsStopAll(int iKey, int clientIndex = -1, int iChannel = SNDCHAN_AUTO)
  **/
 int SoundsKeyToIndex(char[] sKey)
 {
-    // Initialize key char
-    static char sSoundKey[SMALL_LINE_LENGTH]; 
+    // Initialize variables
+    static char sSoundKey[SMALL_LINE_LENGTH]; static int keyIndex[SOUNDS_KEY_DUPLICATES];
     
-    // i = block index
-    int iSize = gServerData.Sounds.Length; int iRandom; static int keyIndex[MAXPLAYERS+1];
-    for(int i = 0; i < iSize; i++)
+    // Gets sound key in lower case
+    strcopy(sSoundKey, sizeof(sSoundKey), sKey);
+    StringToLower(sSoundKey);
+    
+    // Gets the blocks of the key
+    int iRandom;
+    if(!gServerData.SoundKeys.GetArray(sSoundKey, keyIndex, sizeof(keyIndex), iRandom) || !iRandom)
     {
-        // Gets sound key 
-        SoundsGetKey(i, sSoundKey, sizeof(sSoundKey));
-        
-        // If keys match, then store index
-        if(!strcmp(sSoundKey, sKey, false))
-        {
-            // Increment amount
-            keyIndex[iRandom++] = i;
-        }
+        return -1;
     }
     
     // Return index
-    return (iRandom) ? keyIndex[GetRandomInt(0, iRandom-1)] : -1;
+    return keyIndex[GetRandomInt(0, iRandom-1)];
 }
 
 /**
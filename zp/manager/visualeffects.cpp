@@ -42,6 +42,7 @@ void VEffectsOnInit(/*void*/)
 {
     // Forward event to sub-modules
     ParticlesOnInit();
+    RagdollOnInit();
 }
 
 /**
@@ -62,6 +63,16 @@ void VEffectsOnPurge(/*void*/)
 {
     // Forward event to sub-modules
     ParticlesOnPurge();
+    RagdollOnPurge();
+}
+
+/**
+ * @brief Sets up natives for library.
+ **/
+void VEffectsOnNativeInit(/*void*/)
+{
+    // Forward event to sub-modules
+    ParticlesOnNativeInit();
 }
 
 /**
@@ -90,6 +101,16 @@ void VEffectsOnCvarInit(/*void*/)
     RagdollOnCvarInit();
     HealthOnCvarInit();
     PlayerVEffectsOnCvarInit();
+    ParticlesOnCvarInit();
+}
+
+/**
+ * @brief Creates commands for effects module.
+ **/
+void VEffectsOnCommandInit(/*void*/)
+{
+    // Forward event to sub-modules
+    ParticlesOnCommandInit();
 }
 
 /*
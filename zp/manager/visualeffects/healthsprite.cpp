@@ -40,6 +40,14 @@ enum ColorType
 /**
  * @endsection
  **/ 
+
+/**
+ * @section Array to store the last sent frames of the sprites.
+ **/
+int HealthSpriteFrame[MAXPLAYERS+1] = { -1, ... };
+/**
+ * @endsection
+ **/ 
  
 /**
  * @brief Health module load function.
@@ -116,6 +124,9 @@ void HealthOnClientUpdate(int clientIndex)
         return;
     }
 
+    // Stop updating of the sprite
+    gClientData[clientIndex].HealthDuration = 0.0;
+
     // Create a sprite
     if(!HealthCreateSprite(clientIndex))
     {
@@ -137,6 +148,9 @@ void HealthOnClientDeath(int clientIndex)
         return;
     }
     
+    // Stop updating of the sprite
+    gClientData[clientIndex].HealthDuration = 0.0;
+    
     // If it exists, then hide sprite 
     HealthHideSprite(clientIndex);
 }
@@ -199,77 +213,78 @@ void HealthOnClientHurt(int clientIndex, int attackerIndex, int iHealth)
         // Calculate frame and update sprite
         HealthShowSprite(attackerIndex, HealthGetFrame(clientIndex));
         
-        // Sets timer for updating sprite
+        // Sets duration for updating sprite
         gClientData[attackerIndex].HealthDuration = gCvarList[CVAR_VEFFECTS_HEALTH_DURATION].FloatValue;
-        delete gClientData[attackerIndex].SpriteTimer;
-        gClientData[attackerIndex].SpriteTimer = CreateTimer(0.1, HealthOnClientSprite, GetClientUserId(attackerIndex), TIMER_REPEAT | TIMER_FLAG_NO_MAPCHANGE);
+        
+        // Start the update loop, if it isn't running yet
+        if(gServerData.SpriteTimer == null)
+        {
+            gServerData.SpriteTimer = CreateTimer(0.1, HealthOnSpriteUpdate, _, TIMER_REPEAT | TIMER_FLAG_NO_MAPCHANGE);
+        }
     }
 }
 
 /**
- * @brief Timer callback, update a player sprite with health.
+ * @brief Timer callback, update all active sprites with health.
+ *
+ * @note One shared loop serves all attackers, 
+ *       the sprite frame is only sent if it was changed.
  *
  * @param hTimer            The timer handle.
- * @param userID            The user id.
  **/
-public Action HealthOnClientSprite(Handle hTimer, int userID)
+public Action HealthOnSpriteUpdate(Handle hTimer)
 {
-    // Gets client index from the user ID
-    int clientIndex = GetClientOfUserId(userID);
-
-    // Validate client
-    if(clientIndex)
+    // Initialize counter
+    int iActive;
+    
+    // i = client index
+    for(int i = 1; i <= MaxClients; i++)
     {
+        // Validate update
+        if(gClientData[i].HealthDuration <= 0.0)
+        {
+            continue;
+        }
+
         // Gets current sprite from the client reference
-        int entityIndex = EntRefToEntIndex(gClientData[clientIndex].AttachmentHealth);
+        int entityIndex = IsClientInGame(i) ? EntRefToEntIndex(gClientData[i].AttachmentHealth) : INVALID_ENT_REFERENCE;
         
         // Validate sprite
-        if(entityIndex != INVALID_ENT_REFERENCE) 
+        if(entityIndex == INVALID_ENT_REFERENCE) 
         {
-            // If duration is over, then stop
-            if(gClientData[clientIndex].HealthDuration <= 0.0)
-            {
-                // Make it invisible
-                AcceptEntityInput(entityIndex, "HideSprite");  
+            gClientData[i].HealthDuration = 0.0;
+            continue;
+        }
         
-                // Clear timer
-                gClientData[clientIndex].SpriteTimer = null;
-                
-                // Destroy timer
-                return Plugin_Stop;
-            }
-            
-            // Substitute counter
-            gClientData[clientIndex].HealthDuration -= 0.1;
-            
-            // Gets the victim index
-            userID = GetClientOfUserId(gClientData[clientIndex].LastAttacker);
-            if(userID)
-            {
-                // Validate invisibility
-                if(ToolsGetClientRenderColor(userID, ColorType_Alpha) <= 0)
-                {
-                    // Make it invisible
-                    AcceptEntityInput(entityIndex, "HideSprite");  
-            
-                    // Clear timer
-                    gClientData[clientIndex].SpriteTimer = null;
-                    
-                    // Destroy timer
-                    return Plugin_Stop;
-                }
+        // Substitute counter
+        gClientData[i].HealthDuration -= 0.1;
         
-                // Calculate frame and update sprite
-                HealthShowSprite(clientIndex, HealthGetFrame(userID));
-
-                // Allow timer
-                return Plugin_Continue;
-            }
+        // Gets the victim index
+        int victimIndex = GetClientOfUserId(gClientData[i].LastAttacker);
+        
+        // If duration is over or victim is gone/invisible, then stop
+        if(gClientData[i].HealthDuration <= 0.0 || !victimIndex || ToolsGetClientRenderColor(victimIndex, ColorType_Alpha) <= 0)
+        {
+            // Make it invisible
+            AcceptEntityInput(entityIndex, "HideSprite");  
+            gClientData[i].HealthDuration = 0.0;
+            continue;
         }
-    }
 
+        // Calculate frame and update sprite
+        HealthShowSprite(i, HealthGetFrame(victimIndex));
+        iActive++;
+    }
+    
+    // Validate active sprites
+    if(iActive)
+    {
+        // Allow timer
+        return Plugin_Continue;
+    }
+    
     // Clear timer
-    gClientData[clientIndex].SpriteTimer = null;
+    gServerData.SpriteTimer = null;
     
     // Destroy timer
     return Plugin_Stop;
@@ -294,6 +309,12 @@ bool HealthCreateSprite(int clientIndex)
         return false;
     }
     
+    // Validate budget
+    if(!EdictsRequest(EdictType_Sprite))
+    {
+        return false;
+    }
+    
     // Initialize sprite char
     static char sSprite[PLATFORM_LINE_LENGTH];
     static char sScale[SMALL_LINE_LENGTH];
@@ -313,11 +334,12 @@ bool HealthCreateSprite(int clientIndex)
         // Hide it
         AcceptEntityInput(entityIndex, "HideSprite");
 
-        // Hook entity callbacks
-        SDKHook(entityIndex, SDKHook_SetTransmit, ParticlesOnTransmit);
+        // Sets transmit rule of the entity
+        ToolsSetEntityTransmit(entityIndex, TransmitType_HideOwner);
 
         // Store the client cache
         gClientData[clientIndex].AttachmentHealth = EntIndexToEntRef(entityIndex);
+        EdictsTrack(entityIndex, EdictType_Sprite);
     }
 
     // Gets sprite var
@@ -331,6 +353,10 @@ bool HealthCreateSprite(int clientIndex)
     {
         // Store the client cache
         gClientData[clientIndex].AttachmentController = EntIndexToEntRef(controllerIndex);
+        EdictsTrack(controllerIndex, EdictType_Sprite);
+        
+        // Reset the frame cache
+        HealthSpriteFrame[clientIndex] = -1;
     }   
 
     // Validate success
@@ -352,6 +378,7 @@ void HealthHideAllSprites(int clientIndex)
         {
             // Hide it!
             HealthHideSprite(i);
+            gClientData[i].HealthDuration = 0.0;
         }
     }
 }
@@ -379,9 +406,12 @@ void HealthShowSprite(int clientIndex, int iFrame)
     // Gets current controller from the client reference
     int entityIndex = EntRefToEntIndex(gClientData[clientIndex].AttachmentController);
 
-    // Validate controller
-    if(entityIndex != INVALID_ENT_REFERENCE) 
+    // Validate controller and frame changes
+    if(entityIndex != INVALID_ENT_REFERENCE && HealthSpriteFrame[clientIndex] != iFrame) 
     {
+        // Store the frame cache
+        HealthSpriteFrame[clientIndex] = iFrame;
+        
         // Initialize frame char
         static char sFrame[SMALL_LINE_LENGTH];
         FormatEx(sFrame, sizeof(sFrame), "%i -1 0 0", iFrame);
@@ -39,11 +39,35 @@ Address particleSystemDictionary;
 Address networkStringTable;
 int ParticleSystem_Count;
 
+/**
+ * Number of max valid entities.
+ **/
+#define PARTICLES_ENTITY_MAX 2048
+
+/**
+ * @section Variables to store the particle pool.
+ **/
+int ParticlesPoolRef[PARTICLES_ENTITY_MAX];
+int ParticlesPoolSerial[PARTICLES_ENTITY_MAX];
+int ParticlesPoolHits;
+int ParticlesPoolMisses;
+int ParticlesTempCount;
+/**
+ * @endsection
+ **/
+
 /**
  * @brief Particles module init function.
  **/
 void ParticlesOnInit(/*void*/)
 {
+    // Initialize a particle pool array
+    gServerData.ParticlePool = new ArrayList();
+    
+    // Initialize the effect index maps
+    gServerData.ParticleIndexes = new StringMap();
+    gServerData.EffectIndexes = new StringMap();
+    
     // If windows, then stop
     if(gServerData.Platform == OS_Windows)
     {
@@ -110,6 +134,8 @@ void ParticlesOnLoad(/*void*/)
     // If windows, then stop
     if(gServerData.Platform == OS_Windows)
     {
+        // Cache the effect indexes
+        ParticlesOnCacheIndexes();
         return;
     }
     
@@ -202,6 +228,52 @@ void ParticlesOnLoad(/*void*/)
         }
     }   
     LockStringTables(bSave);
+    
+    // Cache the effect indexes
+    ParticlesOnCacheIndexes();
+}
+
+/**
+ * @brief Resolves all effect names of the precached tables into the index maps.
+ **/
+void ParticlesOnCacheIndexes(/*void*/)
+{
+    // Initialize buffer char
+    static char sBuffer[PLATFORM_LINE_LENGTH];
+    
+    // Searches for a string tables
+    int particleTable = FindStringTable("ParticleEffectNames");
+    int effectTable = FindStringTable("EffectDispatch");
+    
+    // Validate table
+    if(particleTable != INVALID_STRING_TABLE)
+    {
+        // i = table string
+        int iCount = GetStringTableNumStrings(particleTable);
+        for(int i = 0; i < iCount; i++)
+        {
+            // Gets the string at a given index
+            ReadStringTable(particleTable, i, sBuffer, sizeof(sBuffer));
+            
+            // Push data into map
+            gServerData.ParticleIndexes.SetValue(sBuffer, i);
+        }
+    }
+    
+    // Validate table
+    if(effectTable != INVALID_STRING_TABLE)
+    {
+        // i = table string
+        int iCount = GetStringTableNumStrings(effectTable);
+        for(int i = 0; i < iCount; i++)
+        {
+            // Gets the string at a given index
+            ReadStringTable(effectTable, i, sBuffer, sizeof(sBuffer));
+            
+            // Push data into map
+            gServerData.EffectIndexes.SetValue(sBuffer, i);
+        }
+    }
 }
 
 /**
@@ -209,6 +281,16 @@ void ParticlesOnLoad(/*void*/)
  **/
 void ParticlesOnPurge(/*void*/)
 {
+    // Clear out the pool (entities are destroyed with the map)
+    gServerData.ParticlePool.Clear();
+    ParticlesPoolHits = 0;
+    ParticlesPoolMisses = 0;
+    ParticlesTempCount = 0;
+    
+    // Clear out the effect indexes (tables are rebuilt on the next map)
+    gServerData.ParticleIndexes.Clear();
+    gServerData.EffectIndexes.Clear();
+    
     // If windows, then stop
     if(gServerData.Platform == OS_Windows)
     {
@@ -228,22 +310,139 @@ void ParticlesOnPurge(/*void*/)
 }
 
 /**
- * Hook: SetTransmit
- * @brief Called right before the entity transmitting to other entities.
+ * @brief Hook particles cvar changes.
+ **/
+void ParticlesOnCvarInit(/*void*/)
+{
+    // Create cvars
+    gCvarList[CVAR_VEFFECTS_PARTICLES_POOL] = FindConVar("zp_veffects_particles_pool");
+}
+
+/**
+ * @brief Sets up natives for library.
+ **/
+void ParticlesOnNativeInit(/*void*/)
+{
+    CreateNative("ZP_GetParticleEffectIndex", API_GetParticleEffectIndex);
+    CreateNative("ZP_GetEffectDispatchIndex", API_GetEffectDispatchIndex);
+    CreateNative("ZP_CreateEffect",           API_CreateEffect);
+}
+
+/**
+ * @brief Creates a particle effect as the temp entity or the pooled entity.
  *
- * @param entityIndex       The entity index.
- * @param clientIndex       The client index.
+ * @note native int ZP_CreateEffect(parentIndex, origin, angles, attach, effect, duration, oneshot);
  **/
-public Action ParticlesOnTransmit(int entityIndex, int clientIndex)
+public int API_CreateEffect(Handle hPlugin, int iNumParams)
 {
-    // Allow particle to be transmittable
-    if(GetEdictFlags(entityIndex) & FL_EDICT_ALWAYS)
+    // Gets parent index from native cell 
+    int parentIndex = GetNativeCell(1);
+    
+    // Validate parent
+    if(parentIndex != -1 && !IsValidEdict(parentIndex))
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Invalid the parent index (%d)", parentIndex);
+        return -1;
+    }
+    
+    // Initialize vector variables
+    static float vPosition[3]; static float vAngle[3];
+    GetNativeArray(2, vPosition, sizeof(vPosition));
+    GetNativeArray(3, vAngle, sizeof(vAngle));
+    
+    // Initialize attachment and effect char
+    static char sAttach[SMALL_LINE_LENGTH]; static char sEffect[PLATFORM_LINE_LENGTH];
+    GetNativeString(4, sAttach, sizeof(sAttach));
+    GetNativeString(5, sEffect, sizeof(sEffect));
+    
+    // Validate effect
+    if(!hasLength(sEffect))
     {
-        SetEdictFlags(entityIndex, (GetEdictFlags(entityIndex) ^ FL_EDICT_ALWAYS));
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_Effects, "Native Validation", "Can't create an effect with an empty name");
+        return -1;
     }
+    
+    // Return the value
+    return ParticlesCreateEffect(parentIndex, vPosition, vAngle, sAttach, sEffect, GetNativeCell(6), GetNativeCell(7));
+}
+
+/**
+ * @brief Gets the index of the particle effect.
+ *
+ * @note native int ZP_GetParticleEffectIndex(name);
+ **/
+public int API_GetParticleEffectIndex(Handle hPlugin, int iNumParams)
+{
+    // Initialize effect char
+    static char sEffect[PLATFORM_LINE_LENGTH];
+    GetNativeString(1, sEffect, sizeof(sEffect));
+    
+    // Return the value
+    return ParticlesGetEffectIndex(sEffect);
+}
+
+/**
+ * @brief Gets the index of the dispatch effect.
+ *
+ * @note native int ZP_GetEffectDispatchIndex(name);
+ **/
+public int API_GetEffectDispatchIndex(Handle hPlugin, int iNumParams)
+{
+    // Initialize effect char
+    static char sEffect[PLATFORM_LINE_LENGTH];
+    GetNativeString(1, sEffect, sizeof(sEffect));
+    
+    // Return the value
+    return ParticlesGetDispatchIndex(sEffect);
+}
 
-    // Validate transmitting
-    return ToolsOnEntityTransmit(entityIndex, clientIndex);
+/**
+ * @brief Creates commands for particles module.
+ **/
+void ParticlesOnCommandInit(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_particles_stats", ParticlesOnCommandCatched, ADMFLAG_GENERIC, "Prints the particle pool statistics.");
+}
+
+/**
+ * Console command callback (zp_particles_stats)
+ * @brief Prints the particle pool statistics.
+ * 
+ * @param clientIndex       The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action ParticlesOnCommandCatched(int clientIndex, int iArguments)
+{
+    // Gets amount of requests
+    int iTotal = ParticlesPoolHits + ParticlesPoolMisses;
+    
+    // Print the statistics
+    ReplyToCommand(clientIndex, "[ZP] Particle pool: %d idle / %d max | hits: %d | misses: %d | hit rate: %.1f%% | temp entities: %d", gServerData.ParticlePool.Length, gCvarList[CVAR_VEFFECTS_PARTICLES_POOL].IntValue, ParticlesPoolHits, ParticlesPoolMisses, iTotal ? float(ParticlesPoolHits) * 100.0 / float(iTotal) : 0.0, ParticlesTempCount);
+    return Plugin_Handled;
+}
+
+/**
+ * @brief Timer callback, releases the pooled particle.
+ *
+ * @param hTimer            The timer handle.
+ * @param iPacked           The packed entity index and usage serial.
+ **/
+public Action ParticlesOnRelease(Handle hTimer, int iPacked)
+{
+    // Unpack the entity index and serial
+    int entityIndex = iPacked & (PARTICLES_ENTITY_MAX - 1);
+    int iSerial = iPacked / PARTICLES_ENTITY_MAX;
+    
+    // Validate the same usage of the entity
+    if(ParticlesPoolSerial[entityIndex] == iSerial && EntRefToEntIndex(ParticlesPoolRef[entityIndex]) == entityIndex)
+    {
+        // Release the particle
+        ParticlesRelease(entityIndex);
+    }
+    
+    // Destroy timer
+    return Plugin_Stop;
 }
 
 /*
@@ -278,8 +477,290 @@ int ParticlesCreate(int parentIndex, char[] sAttach, char[] sEffect, float flDur
         ToolsGetClientAbsAngles(parentIndex, vAngle);
     }
 
+    // Create a particle
+    return ParticlesSpawn(parentIndex, vPosition, vAngle, sAttach, sEffect, flDurationTime);
+}
+
+/**
+ * @brief Create a particle effect as the temp entity or the pooled entity.
+ * 
+ * @note Effects which aren't attached to anything are dispatched as a temp entity to the clients in the visibility range,
+ *       so they don't take any edict, if they are marked as one-shot or have no duration.
+ *       The duration can't stop a temp entity, so any other effects are taken from the pool.
+ *
+ * @param parentIndex       The parent index or -1 for the world effect.
+ * @param vPosition         The origin of the spawn.
+ * @param vAngle            The angle to the spawn.
+ * @param sAttach           The attachment name.
+ * @param sEffect           The particle name.
+ * @param flDurationTime    The duration of an effect.
+ * @param bOneShot          True if the effect ends by itself, false if it could loop and has to be stopped.
+ * @return                  The entity index, 0 if the effect was dispatched as the temp entity, or -1 on failure.
+ **/
+int ParticlesCreateEffect(int parentIndex, float vPosition[3], float vAngle[3], char[] sAttach, char[] sEffect, float flDurationTime, bool bOneShot)
+{
+    // Validate one-shot effect in the world
+    if(parentIndex == -1 && (bOneShot || flDurationTime <= 0.0))
+    {
+        // Validate effect
+        if(ParticlesGetEffectIndex(sEffect) == INVALID_STRING_INDEX)
+        {
+            return -1;
+        }
+        
+        // Dispatch an effect
+        TE_DispatchEffect(_, sEffect, "ParticleEffect", vPosition, vPosition, vAngle);
+        TE_SendToAllInRange(vPosition, RangeType_Visibility);
+        ParticlesTempCount++;
+        
+        // Return on success
+        return 0;
+    }
+    
+    // Validate attachment
+    if(hasLength(sAttach) && !ToolsLookupAttachment(parentIndex, sAttach))
+    {
+        return -1;
+    }
+    
+    // Create a particle
+    return ParticlesSpawn(parentIndex, vPosition, vAngle, sAttach, sEffect, flDurationTime);
+}
+
+/**
+ * @brief Spawn a particle entity from the pool.
+ * 
+ * @param parentIndex       The parent index or -1 for the world effect.
+ * @param vPosition         The origin of the spawn.
+ * @param vAngle            The angle to the spawn.
+ * @param sAttach           The attachment name.
+ * @param sEffect           The particle name.
+ * @param flDurationTime    The duration of an effect.
+ * @return                  The entity index.
+ **/
+int ParticlesSpawn(int parentIndex, float vPosition[3], float vAngle[3], char[] sAttach, char[] sEffect, float flDurationTime)
+{
+    // Validate pool
+    if(!gCvarList[CVAR_VEFFECTS_PARTICLES_POOL].IntValue)
+    {
+        // Validate budget
+        if(!EdictsRequest(EdictType_Particle))
+        {
+            return -1;
+        }
+    
+        // Create a new particle
+        int entityIndex = UTIL_CreateParticle(parentIndex, vPosition, vAngle, sAttach, sEffect, flDurationTime);
+        EdictsTrack(entityIndex, EdictType_Particle);
+        
+        // Return on success
+        return entityIndex;
+    }
+    
+    // Gets the idle particle
+    int entityIndex = ParticlesPoolPop(sEffect);
+    
+    // Validate particle
+    if(entityIndex != INVALID_ENT_REFERENCE)
+    {
+        // Teleport the entity
+        TeleportEntity(entityIndex, vPosition, vAngle, NULL_VECTOR);
+        
+        // Validate parent
+        if(parentIndex != -1)
+        {
+            // Sets parent to the entity
+            SetVariantString("!activator");
+            AcceptEntityInput(entityIndex, "SetParent", parentIndex, entityIndex);
+            ToolsSetEntityOwner(entityIndex, parentIndex);
+            
+            // Sets attachment to the entity
+            if(hasLength(sAttach))
+            { 
+                SetVariantString(sAttach); 
+                AcceptEntityInput(entityIndex, "SetParentAttachment", parentIndex, entityIndex);
+            }
+        }
+        
+        // Start the effect
+        AcceptEntityInput(entityIndex, "Start");
+        ParticlesPoolHits++;
+    }
+    else
+    {
+        // Validate budget
+        if(!EdictsRequest(EdictType_Particle))
+        {
+            return -1;
+        }
+    
+        // Create a new particle
+        entityIndex = UTIL_CreateParticle(parentIndex, vPosition, vAngle, sAttach, sEffect);
+        EdictsTrack(entityIndex, EdictType_Particle);
+        ParticlesPoolMisses++;
+        
+        // Validate particle
+        if(entityIndex == INVALID_ENT_REFERENCE)
+        {
+            return -1;
+        }
+        
+        // Mark the entity as pooled
+        ParticlesPoolRef[entityIndex] = EntIndexToEntRef(entityIndex);
+    }
+    
+    // Starts a new usage of the entity
+    int iSerial = ++ParticlesPoolSerial[entityIndex] & 0xFFFFF;
+    ParticlesPoolSerial[entityIndex] = iSerial;
+    
+    // Validate duration
+    if(flDurationTime > 0.0)
+    {
+        // Release entity after delay
+        CreateTimer(flDurationTime, ParticlesOnRelease, iSerial * PARTICLES_ENTITY_MAX + entityIndex, TIMER_FLAG_NO_MAPCHANGE);
+    }
+    
     // Return on success
-    return UTIL_CreateParticle(parentIndex, vPosition, vAngle, sAttach, sEffect, flDurationTime);
+    return entityIndex;
+}
+
+/**
+ * @brief Gets the index of the particle effect from the index map.
+ * 
+ * @param sEffect           The particle name.
+ * @return                  The string index or -1 if the effect isn't precached.
+ **/
+int ParticlesGetEffectIndex(const char[] sEffect)
+{
+    // Validate cached index
+    int iEffect;
+    if(gServerData.ParticleIndexes.GetValue(sEffect, iEffect))
+    {
+        return iEffect;
+    }
+    
+    // Initialize the table index
+    static int tableIndex = INVALID_STRING_TABLE;
+
+    // Validate table
+    if(tableIndex == INVALID_STRING_TABLE)
+    {
+        // Searches for a string table
+        tableIndex = FindStringTable("ParticleEffectNames");
+    }
+    
+    // Searches for the index of the effect precached after the map start
+    iEffect = FindStringIndex(tableIndex, sEffect);
+    if(iEffect != INVALID_STRING_INDEX)
+    {
+        // Push data into map
+        gServerData.ParticleIndexes.SetValue(sEffect, iEffect);
+    }
+    
+    // Return the index
+    return iEffect;
+}
+
+/**
+ * @brief Gets the index of the dispatch effect from the index map.
+ * 
+ * @param sEffect           The effect name.
+ * @return                  The string index or -1 if the effect isn't registered.
+ **/
+int ParticlesGetDispatchIndex(const char[] sEffect)
+{
+    // Validate cached index
+    int iEffect;
+    if(gServerData.EffectIndexes.GetValue(sEffect, iEffect))
+    {
+        return iEffect;
+    }
+    
+    // Initialize the table index
+    static int tableIndex = INVALID_STRING_TABLE;
+
+    // Validate table
+    if(tableIndex == INVALID_STRING_TABLE)
+    {
+        // Searches for a string table
+        tableIndex = FindStringTable("EffectDispatch");
+    }
+    
+    // Searches for the index of the effect registered after the map start
+    iEffect = FindStringIndex(tableIndex, sEffect);
+    if(iEffect != INVALID_STRING_INDEX)
+    {
+        // Push data into map
+        gServerData.EffectIndexes.SetValue(sEffect, iEffect);
+    }
+    
+    // Return the index
+    return iEffect;
+}
+
+/**
+ * @brief Gets the idle particle from the pool.
+ * 
+ * @param sEffect           The particle name.
+ * @return                  The entity index or -1 if pool is empty.
+ **/
+int ParticlesPoolPop(char[] sEffect)
+{
+    // Validate effect
+    int iEffect = ParticlesGetEffectIndex(sEffect);
+    if(iEffect == INVALID_STRING_INDEX)
+    {
+        return -1;
+    }
+    
+    // i = pool index
+    int iSize = gServerData.ParticlePool.Length;
+    for(int i = iSize - 1; i >= 0; i--)
+    {
+        // Gets the particle from the pool
+        int entityIndex = EntRefToEntIndex(gServerData.ParticlePool.Get(i));
+        gServerData.ParticlePool.Erase(i);
+        
+        // Validate particle (could be destroyed on round restart)
+        if(entityIndex != INVALID_ENT_REFERENCE && ParticlesPoolRef[entityIndex] == EntIndexToEntRef(entityIndex))
+        {
+            // Sets the effect to the entity
+            DispatchKeyValue(entityIndex, "effect_name", sEffect);
+            SetEntProp(entityIndex, Prop_Send, "m_iEffectIndex", iEffect);
+            return entityIndex;
+        }
+    }
+    
+    // Return on unsuccess
+    return -1;
+}
+
+/**
+ * @brief Stops the particle and returns it into the pool.
+ * 
+ * @param entityIndex       The entity index.
+ **/
+void ParticlesRelease(int entityIndex)
+{
+    // Ends the current usage of the entity
+    ParticlesPoolSerial[entityIndex]++;
+    
+    // Validate free space
+    if(gServerData.ParticlePool.Length >= gCvarList[CVAR_VEFFECTS_PARTICLES_POOL].IntValue)
+    {
+        // Unmark the entity and destroy it
+        ParticlesPoolRef[entityIndex] = 0;
+        AcceptEntityInput(entityIndex, "Kill");
+        return;
+    }
+    
+    // Stop the effect and detach the entity
+    AcceptEntityInput(entityIndex, "DestroyImmediately");
+    AcceptEntityInput(entityIndex, "ClearParent");
+    ToolsSetEntityOwner(entityIndex, -1);
+    
+    // Push data into array
+    gServerData.ParticlePool.Push(ParticlesPoolRef[entityIndex]);
 }
 
 /**
@@ -308,7 +789,15 @@ void ParticlesRemove(int clientIndex)
                 // Validate parent
                 if(ToolsGetEntityOwner(i) == clientIndex)
                 {
-                    AcceptEntityInput(i, "Kill"); /// Destroy
+                    // Validate pooled particle
+                    if(ParticlesPoolRef[i] == EntIndexToEntRef(i))
+                    {
+                        ParticlesRelease(i); /// Reuse
+                    }
+                    else
+                    {
+                        AcceptEntityInput(i, "Kill"); /// Destroy
+                    }
                 }
             }
         }
@@ -332,8 +821,8 @@ void ParticlesMuzzleCreate(int clientIndex, int entityIndex, char[] sEffect)
     // Validate entity
     if(entityIndex != entityIndex)
     {
-        // Hook entity callbacks
-        SDKHook(entityIndex, SDKHook_SetTransmit, ParticlesOnTransmit);
+        // Sets transmit rule of the entity
+        ToolsSetEntityTransmit(entityIndex, TransmitType_HideOwner);
     }*/
 }
 
@@ -38,6 +38,42 @@
  * @endsection
  **/
 
+/**
+ * @section Ragdoll queue data indexes.
+ **/
+enum
+{
+    RAGDOLL_DATA_REFERENCE,
+    RAGDOLL_DATA_TIME
+};
+/**
+ * @endsection
+ **/
+
+/**
+ * Variable to store the reference of the shared dissolver.
+ **/
+int RagdollDissolver = INVALID_ENT_REFERENCE;
+
+/**
+ * @brief Ragdoll module init function.
+ **/
+void RagdollOnInit(/*void*/)
+{
+    // Create the cleanup queue
+    gServerData.Ragdolls = new ArrayList(2);
+}
+
+/**
+ * @brief Ragdoll module purge function.
+ **/
+void RagdollOnPurge(/*void*/)
+{
+    // Clear the cleanup queue
+    gServerData.Ragdolls.Clear();
+    RagdollDissolver = INVALID_ENT_REFERENCE;
+}
+
 /**
  * @brief Hook ragdoll cvar changes.
  **/
@@ -47,6 +83,7 @@ void RagdollOnCvarInit(/*void*/)
     gCvarList[CVAR_VEFFECTS_RAGDOLL_REMOVE]   = FindConVar("zp_veffects_ragdoll_remove");
     gCvarList[CVAR_VEFFECTS_RAGDOLL_DISSOLVE] = FindConVar("zp_veffects_ragdoll_dissolve");
     gCvarList[CVAR_VEFFECTS_RAGDOLL_DELAY]    = FindConVar("zp_veffects_ragdoll_delay");
+    gCvarList[CVAR_VEFFECTS_RAGDOLL_TICK]     = FindConVar("zp_veffects_ragdoll_tick");
 }
  
 /**
@@ -74,83 +111,157 @@ void RagdollOnClientDeath(int clientIndex)
         return;
     }
 
-    // If the delay is zero, then remove right now
-    float flDissolveDelay = gCvarList[CVAR_VEFFECTS_RAGDOLL_DELAY].FloatValue;
-    if(!flDissolveDelay)
+    // Push the ragdoll into the cleanup queue
+    int iIndex = gServerData.Ragdolls.Push(EntIndexToEntRef(iRagdoll));
+    gServerData.Ragdolls.Set(iIndex, GetGameTime() + gCvarList[CVAR_VEFFECTS_RAGDOLL_DELAY].FloatValue, RAGDOLL_DATA_TIME);
+
+    // Start the cleanup loop, if it isn't running yet
+    if(gServerData.RagdollTimer == null)
     {
-        RagdollOnEntityRemove(null, EntIndexToEntRef(iRagdoll));
-        return;
+        gServerData.RagdollTimer = CreateTimer(0.1, RagdollOnCleanup, _, TIMER_REPEAT | TIMER_FLAG_NO_MAPCHANGE);
     }
-
-    // Create a timer to remove/dissolve ragdoll
-    CreateTimer(flDissolveDelay, RagdollOnEntityRemove, EntIndexToEntRef(iRagdoll), TIMER_FLAG_NO_MAPCHANGE);
 }
 
 /**
- * @brief Timer callback, removed a client ragdoll.
+ * @brief Timer callback, removes the queued ragdolls.
+ *
+ * @note One shared loop removes a limited amount of ragdolls per tick,
+ *       the rest waits for the next ticks.
  * 
  * @param hTimer            The timer handle. 
- * @param referenceIndex    The reference index.
  **/
-public Action RagdollOnEntityRemove(Handle hTimer, int referenceIndex)
+public Action RagdollOnCleanup(Handle hTimer)
 {
-    // Gets the ragdoll index from the reference
-    int iRagdoll = EntRefToEntIndex(referenceIndex);
+    // Gets the limit and the current time
+    int iLimit = gCvarList[CVAR_VEFFECTS_RAGDOLL_TICK].IntValue;
+    float flTime = GetGameTime();
+    
+    // Initialize counter
+    int iCount;
+    
+    // Process the queue in order of the death
+    while(gServerData.Ragdolls.Length)
+    {
+        // Validate delay and limit
+        if(view_as<float>(gServerData.Ragdolls.Get(0, RAGDOLL_DATA_TIME)) > flTime || (iLimit && iCount >= iLimit))
+        {
+            // Allow timer
+            return Plugin_Continue;
+        }
+        
+        // Gets the ragdoll index from the reference
+        int iRagdoll = EntRefToEntIndex(gServerData.Ragdolls.Get(0, RAGDOLL_DATA_REFERENCE));
+        gServerData.Ragdolls.Erase(0);
+        
+        // Remove the ragdoll
+        if(RagdollRemove(iRagdoll)) iCount++;
+    }
+    
+    // Clear timer
+    gServerData.RagdollTimer = null;
+    
+    // Destroy timer
+    return Plugin_Stop;
+}
 
+/**
+ * @brief Removes/dissolves the ragdoll.
+ * 
+ * @param iRagdoll          The ragdoll index.
+ * @return                  True if the ragdoll was removed, false otherwise.
+ **/
+bool RagdollRemove(int iRagdoll)
+{
     // If the ragdoll is already gone, then stop
-    if(iRagdoll != INVALID_ENT_REFERENCE)
+    if(iRagdoll == INVALID_ENT_REFERENCE)
     {
-        // Make sure this edict is still a ragdoll and not become a new valid entity
-        static char sClassname[SMALL_LINE_LENGTH];
-        GetEdictClassname(iRagdoll, sClassname, sizeof(sClassname));
+        return false;
+    }
+    
+    // Make sure this edict is still a ragdoll and not become a new valid entity
+    static char sClassname[SMALL_LINE_LENGTH];
+    GetEdictClassname(iRagdoll, sClassname, sizeof(sClassname));
 
-        // Validate classname
-        if(!strcmp(sClassname, "cs_ragdoll", false))
-        {
-            // Gets dissolve type
-            int iRagDollType = gCvarList[CVAR_VEFFECTS_RAGDOLL_DISSOLVE].IntValue;
-
-            // Check the dissolve type
-            if(iRagDollType == VEFFECTS_RAGDOLL_DISSOLVE_EFFECTLESS)
-            {
-                // Remove entity from world
-                AcceptEntityInput(iRagdoll, "Kill");
-                return;
-            }
-
-            // If random, set value to any between "energy" effect and "core" effect
-            if(iRagDollType == VEFFECTS_RAGDOLL_DISSOLVE_RANDOM)
-            {
-                iRagDollType = GetRandomInt(VEFFECTS_RAGDOLL_DISSOLVE_ENERGY, VEFFECTS_RAGDOLL_DISSOLVE_CORE);
-            }
-
-            // Prep the ragdoll for dissolving
-            static char sTarget[SMALL_LINE_LENGTH];
-            FormatEx(sTarget, sizeof(sTarget), "dissolve%d", iRagdoll);
-            DispatchKeyValue(iRagdoll, "targetname", sTarget);
-
-            // Prep the dissolve entity
-            int iDissolver = CreateEntityByName("env_entity_dissolver");
-            
-            // If dissolve entity isn't valid, then stop
-            if(iDissolver != INVALID_ENT_REFERENCE)
-            {
-                // Sets target to the ragdoll
-                DispatchKeyValue(iDissolver, "target", sTarget);
-
-                // Sets dissolve type
-                static char sDissolveType[SMALL_LINE_LENGTH];
-                FormatEx(sDissolveType, sizeof(sDissolveType), "%d", iRagDollType);
-                DispatchKeyValue(iDissolver, "dissolvetype", sDissolveType);
-
-                // Tell the entity to dissolve the ragdoll
-                AcceptEntityInput(iDissolver, "Dissolve");
-
-                // Remove the dissolver
-                AcceptEntityInput(iDissolver, "Kill");
-            }
-        }
+    // Validate classname
+    if(strcmp(sClassname, "cs_ragdoll", false))
+    {
+        return false;
+    }
+    
+    // Gets dissolve type
+    int iRagDollType = gCvarList[CVAR_VEFFECTS_RAGDOLL_DISSOLVE].IntValue;
+
+    // Gets the shared dissolver
+    int iDissolver = (iRagDollType == VEFFECTS_RAGDOLL_DISSOLVE_EFFECTLESS) ? INVALID_ENT_REFERENCE : RagdollGetDissolver();
+    
+    // Check the dissolve type, or the dissolver
+    if(iDissolver == INVALID_ENT_REFERENCE)
+    {
+        // Remove entity from world
+        AcceptEntityInput(iRagdoll, "Kill");
+        return true;
+    }
+
+    // If random, set value to any between "energy" effect and "core" effect
+    if(iRagDollType == VEFFECTS_RAGDOLL_DISSOLVE_RANDOM)
+    {
+        iRagDollType = GetRandomInt(VEFFECTS_RAGDOLL_DISSOLVE_ENERGY, VEFFECTS_RAGDOLL_DISSOLVE_CORE);
+    }
+
+    // Prep the ragdoll for dissolving
+    static char sTarget[SMALL_LINE_LENGTH];
+    FormatEx(sTarget, sizeof(sTarget), "dissolve%d", iRagdoll);
+    DispatchKeyValue(iRagdoll, "targetname", sTarget);
+
+    // Sets dissolve type
+    static char sDissolveType[SMALL_LINE_LENGTH];
+    FormatEx(sDissolveType, sizeof(sDissolveType), "%d", iRagDollType);
+    DispatchKeyValue(iDissolver, "dissolvetype", sDissolveType);
+
+    // Tell the entity to dissolve the ragdoll
+    SetVariantString(sTarget);
+    AcceptEntityInput(iDissolver, "Dissolve");
+    return true;
+}
+
+/**
+ * @brief Gets the shared dissolver, creates it if it doesn't exist.
+ * 
+ * @return                  The dissolver index.
+ **/
+int RagdollGetDissolver(/*void*/)
+{
+    // Gets the dissolver from the reference
+    int iDissolver = EntRefToEntIndex(RagdollDissolver);
+    
+    // Validate dissolver
+    if(iDissolver != INVALID_ENT_REFERENCE)
+    {
+        return iDissolver;
+    }
+    
+    // Validate budget
+    if(!EdictsRequest(EdictType_Effect))
+    {
+        return INVALID_ENT_REFERENCE;
+    }
+    
+    // Prep the dissolve entity
+    iDissolver = CreateEntityByName("env_entity_dissolver");
+    
+    // If dissolve entity isn't valid, then stop
+    if(iDissolver != INVALID_ENT_REFERENCE)
+    {
+        // Spawn the entity into the world
+        DispatchSpawn(iDissolver);
+        EdictsTrack(iDissolver, EdictType_Effect);
+        
+        // Store the dissolver cache
+        RagdollDissolver = EntIndexToEntRef(iDissolver);
     }
+    
+    // Return on success
+    return iDissolver;
 }
 
 /**
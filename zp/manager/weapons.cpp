@@ -30,6 +30,21 @@
  **/
 #define WEAPONS_SEQUENCE_MAX 32
 
+/**
+ * Number of max valid weapons in the purchase ledger. (Larger ids are kept in the client map)
+ **/
+#define WEAPONS_LEDGER_MAX 256
+
+/**
+ * @section Arrays to store the weapon purchase ledger.
+ **/
+int WeaponsLedgerCount[MAXPLAYERS+1][WEAPONS_LEDGER_MAX];
+int WeaponsLedgerGeneration[MAXPLAYERS+1][WEAPONS_LEDGER_MAX];
+int WeaponsLedgerRound[MAXPLAYERS+1];
+/**
+ * @endsection
+ **/
+ 
 /**
  * @section Weapon config data indexes.
  **/
@@ -146,6 +161,9 @@ void WeaponsOnLoad(/*void*/)
  **/
 void WeaponsOnCacheData(/*void*/)
 {
+    // Remove cached menu lines (indexes can be changed)
+    MenusClearCache();
+    
     // Gets config file path
     static char sPathWeapons[PLATFORM_LINE_LENGTH];
     ConfigGetConfigPath(File_Weapons, sPathWeapons, sizeof(sPathWeapons));
@@ -168,7 +186,7 @@ void WeaponsOnCacheData(/*void*/)
         LogEvent(false, LogType_Fatal, LOG_GAME_EVENTS, LogModule_Weapons, "Config Validation", "No usable data found in weapons config file: \"%s\"", sPathWeapons);
         return;
     }
-
+    
     // i = array index
     for(int i = 0; i < iSize; i++)
     {
@@ -271,6 +289,13 @@ void WeaponsOnUnload(/*void*/)
  **/
 public void WeaponsOnConfigReload(/*void*/)
 {
+    // i = client index
+    for(int i = 1; i <= MaxClients; i++)
+    {
+        // Resets limits (indexes can be changed)
+        WeaponsRemoveLimits(i);
+    }
+    
     // Reloads weapons config
     WeaponsOnLoad();
 }
@@ -1720,15 +1745,14 @@ int WeaponsGetLimit(int iD)
  **/
 void WeaponsRemoveLimits(int clientIndex)
 {
-    // If array hasn't been created, then create
-    if(gClientData[clientIndex].WeaponLimit == null)
+    // Starts a new ledger generation (old counts are ignored)
+    WeaponsLedgerRound[clientIndex]++;
+    
+    // Clear out the overflow map of all data
+    if(gClientData[clientIndex].WeaponLimit != null)
     {
-        // Initialize a buy limit array
-        gClientData[clientIndex].WeaponLimit = new StringMap();
+        gClientData[clientIndex].WeaponLimit.Clear();
     }
-
-    // Clear out the array of all data
-    gClientData[clientIndex].WeaponLimit.Clear();
 }
 
 /**
@@ -1740,19 +1764,34 @@ void WeaponsRemoveLimits(int clientIndex)
  **/
 void WeaponsSetLimits(int clientIndex, int iD, int iLimit)
 {
-    // If array hasn't been created, then create
-    if(gClientData[clientIndex].WeaponLimit == null)
+    // Validate index
+    if(iD < 0)
     {
-        // Initialize a buy limit array
-        gClientData[clientIndex].WeaponLimit = new StringMap();
+        return;
+    }
+    
+    // Validate index out of the ledger
+    if(iD >= WEAPONS_LEDGER_MAX)
+    {
+        // If array hasn't been created, then create
+        if(gClientData[clientIndex].WeaponLimit == null)
+        {
+            // Initialize a buy limit array
+            gClientData[clientIndex].WeaponLimit = new StringMap();
+        }
+        
+        // Initialize key char
+        static char sKey[SMALL_LINE_LENGTH];
+        IntToString(iD, sKey, sizeof(sKey));
+        
+        // Sets buy limit for the client
+        gClientData[clientIndex].WeaponLimit.SetValue(sKey, iLimit);
+        return;
     }
-
-    // Initialize key char
-    static char sKey[SMALL_LINE_LENGTH];
-    IntToString(iD, sKey, sizeof(sKey));
     
     // Sets buy limit for the client
-    gClientData[clientIndex].WeaponLimit.SetValue(sKey, iLimit);
+    WeaponsLedgerCount[clientIndex][iD] = iLimit;
+    WeaponsLedgerGeneration[clientIndex][iD] = WeaponsLedgerRound[clientIndex];
 }
 
 /**
@@ -1763,20 +1802,32 @@ void WeaponsSetLimits(int clientIndex, int iD, int iLimit)
  **/
 int WeaponsGetLimits(int clientIndex, int iD)
 {
-    // If array hasn't been created, then create
-    if(gClientData[clientIndex].WeaponLimit == null)
+    // Validate index
+    if(iD < 0)
     {
-        // Initialize a buy limit array
-        gClientData[clientIndex].WeaponLimit = new StringMap();
+        return 0;
     }
     
-    // Initialize key char
-    static char sKey[SMALL_LINE_LENGTH];
-    IntToString(iD, sKey, sizeof(sKey));
+    // Validate index out of the ledger
+    if(iD >= WEAPONS_LEDGER_MAX)
+    {
+        // Validate array
+        if(gClientData[clientIndex].WeaponLimit == null)
+        {
+            return 0;
+        }
+        
+        // Initialize key char
+        static char sKey[SMALL_LINE_LENGTH];
+        IntToString(iD, sKey, sizeof(sKey));
+        
+        // Gets buy limit for the client
+        int iLimit; gClientData[clientIndex].WeaponLimit.GetValue(sKey, iLimit);
+        return iLimit;
+    }
     
-    // Gets buy limit for the client
-    int iLimit; gClientData[clientIndex].WeaponLimit.GetValue(sKey, iLimit);
-    return iLimit;
+    // Gets buy limit for the client, if it was set in the current generation
+    return (WeaponsLedgerGeneration[clientIndex][iD] == WeaponsLedgerRound[clientIndex]) ? WeaponsLedgerCount[clientIndex][iD] : 0;
 }
 
 /**
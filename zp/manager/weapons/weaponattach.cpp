@@ -482,8 +482,8 @@ void WeaponAttachCreateAddons(int clientIndex, int iD, BitType mBits, char[] sAt
     // If dropmodel exist, then apply it
     if(WeaponsGetModelDropID(iD))
     {
-        // Validate attachment
-        if(ToolsLookupAttachment(clientIndex, sAttach))
+        // Validate attachment and budget
+        if(ToolsLookupAttachment(clientIndex, sAttach) && EdictsRequest(EdictType_Addon))
         {
             // Gets weapon dropmodel
             static char sModel[PLATFORM_LINE_LENGTH];
@@ -512,11 +512,12 @@ void WeaponAttachCreateAddons(int clientIndex, int iD, BitType mBits, char[] sAt
                 SetVariantString(sAttach);
                 AcceptEntityInput(entityIndex, "SetParentAttachment", clientIndex, entityIndex);
                 
-                // Hook entity callbacks
-                SDKHook(entityIndex, SDKHook_SetTransmit, ToolsOnEntityTransmit);
+                // Sets transmit rule of the entity
+                ToolsSetEntityTransmit(entityIndex, TransmitType_HideOwner);
                 
                 // Store the client cache
                 gClientData[clientIndex].AttachmentAddons[mBits] = EntIndexToEntRef(entityIndex);
+                EdictsTrack(entityIndex, EdictType_Addon);
             }
         }
     }
@@ -258,12 +258,7 @@ void ZMarketMenu(int clientIndex, char[] sTitle, MenuType mSlot = MenuType_Invis
 
     // Initialize variables
     static char sBuffer[NORMAL_LINE_LENGTH];
-    static char sName[SMALL_LINE_LENGTH];
     static char sInfo[SMALL_LINE_LENGTH];
-    static char sLevel[SMALL_LINE_LENGTH];
-    static char sLimit[SMALL_LINE_LENGTH];
-    static char sOnline[SMALL_LINE_LENGTH];
-    static char sGroup[SMALL_LINE_LENGTH];
 
     // Creates menu handle
     Menu hMenu = CreateMenu(ZMarketMenuSlots);
@@ -277,15 +272,19 @@ void ZMarketMenu(int clientIndex, char[] sTitle, MenuType mSlot = MenuType_Invis
     // Sets title
     hMenu.SetTitle(sBuffer);
     
+    // Gets menu lines
+    ArrayList hList = ZMarketGetLines(clientIndex, mSlot);
+    
     // Initialize variables
-    Action resultHandle; bool bMenu = mSlot != MenuType_Invisible;
+    Action resultHandle; MenuLineData lineData; int iPlaying = fnGetPlaying();
     
-    // i = array number
-    int iCount = bMenu ? gServerData.Weapons.Length : gClientData[clientIndex].ShoppingCart.Length;
+    // i = line index
+    int iCount = hList.Length;
     for(int i = 0; i < iCount; i++)
     {
-        // Gets weapon id from the list
-        int iD = bMenu ? i : gClientData[clientIndex].ShoppingCart.Get(i);
+        // Gets weapon data from the list
+        hList.GetArray(i, lineData, sizeof(lineData));
+        int iD = lineData.ID;
         
         // Call forward
         gForwardData._OnClientValidateWeapon(clientIndex, iD, resultHandle);
@@ -296,31 +295,21 @@ void ZMarketMenu(int clientIndex, char[] sTitle, MenuType mSlot = MenuType_Invis
             continue;
         }
         
-        // Skip some weapons, if slot isn't equal
-        if(bMenu && WeaponsGetSlot(iD) != mSlot) 
-        {
-            continue;
-        }
-        
-        // Skip some weapons, if class isn't equal
-        if(!WeaponsValidateClass(clientIndex, iD))
-        {
-            continue;
-        }    
-    
-        // Gets weapon data
-        WeaponsGetName(iD, sName, sizeof(sName));
-        WeaponsGetGroup(iD, sGroup, sizeof(sGroup));
+        // Gets weapon limits
+        int iLimits = WeaponsGetLimits(clientIndex, iD);
         
         // Format some chars for showing in menu
-        FormatEx(sLevel, sizeof(sLevel), "%t", "level", WeaponsGetLevel(iD));
-        FormatEx(sLimit, sizeof(sLimit), "%t", "limit", WeaponsGetLimit(iD));
-        FormatEx(sOnline, sizeof(sOnline), "%t", "online", WeaponsGetOnline(iD));      
-        FormatEx(sBuffer, sizeof(sBuffer), (WeaponsGetCost(iD)) ? "%t  %s  %t" : "%t  %s", sName, hasLength(sGroup) ? sGroup : (gClientData[clientIndex].Level < WeaponsGetLevel(iD)) ? sLevel : (WeaponsGetLimit(iD) && WeaponsGetLimit(iD) <= WeaponsGetLimits(clientIndex, iD)) ? sLimit : (fnGetPlaying() < WeaponsGetOnline(iD)) ? sOnline : "", "price", WeaponsGetCost(iD), "money");
+        MenusFormatLine(clientIndex, iPlaying, iLimits, hasLength(lineData.Group), lineData, sBuffer, sizeof(sBuffer));
 
         // Show option
         IntToString(iD, sInfo, sizeof(sInfo));
-        hMenu.AddItem(sInfo, sBuffer, MenusGetItemDraw(resultHandle == Plugin_Handled || (hasLength(sGroup) && !IsPlayerInGroup(clientIndex, sGroup)) || WeaponsValidateID(clientIndex, iD) || gClientData[clientIndex].Level < WeaponsGetLevel(iD) || fnGetPlaying() < WeaponsGetOnline(iD) || WeaponsGetLimit(iD) && WeaponsGetLimit(iD) <= WeaponsGetLimits(clientIndex, iD) || gClientData[clientIndex].Money < WeaponsGetCost(iD) ? false : true));
+        hMenu.AddItem(sInfo, sBuffer, MenusGetItemDraw(resultHandle == Plugin_Handled || (hasLength(lineData.Group) && !IsPlayerInGroup(clientIndex, lineData.Group)) || WeaponsValidateID(clientIndex, iD) || gClientData[clientIndex].Level < lineData.Level || iPlaying < lineData.Online || lineData.Limit && lineData.Limit <= iLimits || gClientData[clientIndex].Money < lineData.Cost ? false : true));
+    }
+    
+    // Close the shopping cart lines
+    if(mSlot == MenuType_Invisible)
+    {
+        delete hList;
     }
     
     // If there are no cases, add an "(Empty)" line
@@ -339,6 +328,115 @@ void ZMarketMenu(int clientIndex, char[] sTitle, MenuType mSlot = MenuType_Invis
     hMenu.Display(clientIndex, MENU_TIME_FOREVER); 
 }
 
+/**
+ * @brief Gets the weapon lines of the menu.
+ *
+ * @note The slot lines are cached for each language and class, the shopping cart lines should be closed.
+ *
+ * @param clientIndex       The client index.
+ * @param mSlot             The slot index selected. (starting from 0)
+ *
+ * @return                  The list of the menu lines. (MenuLineData)
+ **/
+ArrayList ZMarketGetLines(int clientIndex, MenuType mSlot)
+{
+    // Initialize variables
+    ArrayList hList; MenuLineData lineData; bool bCreated = true;
+    
+    // Validate shopping cart
+    if(mSlot == MenuType_Invisible)
+    {
+        // i = array number
+        hList = new ArrayList(sizeof(MenuLineData));
+        int iSize = gClientData[clientIndex].ShoppingCart.Length;
+        for(int i = 0; i < iSize; i++)
+        {
+            // Gets weapon id from the list
+            int iD = gClientData[clientIndex].ShoppingCart.Get(i);
+            
+            // Skip some weapons, if class isn't equal
+            if(!WeaponsValidateClass(clientIndex, iD))
+            {
+                continue;
+            }
+            
+            // Push data into array
+            ZMarketGetLine(iD, lineData);
+            hList.PushArray(lineData, sizeof(lineData));
+        }
+        
+        // Return on success
+        return hList;
+    }
+    
+    // Gets cached lines
+    hList = MenusGetCache(clientIndex, "zmarket", view_as<int>(mSlot), bCreated);
+    
+    // Validate cache
+    if(bCreated)
+    {
+        // i = weapon index
+        int iSize = gServerData.Weapons.Length;
+        for(int i = 0; i < iSize; i++)
+        {
+            // Skip some weapons, if slot isn't equal
+            if(WeaponsGetSlot(i) != mSlot) 
+            {
+                continue;
+            }
+            
+            // Skip some weapons, if class isn't equal
+            if(!WeaponsValidateClass(clientIndex, i))
+            {
+                continue;
+            }
+            
+            // Push data into array
+            ZMarketGetLine(i, lineData);
+            hList.PushArray(lineData, sizeof(lineData));
+        }
+    }
+    
+    // Return on success
+    return hList;
+}
+
+/**
+ * @brief Gets the weapon line of the menu.
+ *
+ * @note The global translation target should be set before.
+ *
+ * @param iD                The weapon index.
+ * @param lineData          The menu line data.
+ **/
+void ZMarketGetLine(int iD, MenuLineData lineData)
+{
+    // Gets weapon data
+    lineData.ID = iD;
+    lineData.Cost = WeaponsGetCost(iD);
+    lineData.Level = WeaponsGetLevel(iD);
+    lineData.Limit = WeaponsGetLimit(iD);
+    lineData.Online = WeaponsGetOnline(iD);
+    WeaponsGetName(iD, lineData.Name, sizeof(lineData.Name));
+    WeaponsGetGroup(iD, lineData.Group, sizeof(lineData.Group));
+    
+    // Format some chars for showing in menu
+    Format(lineData.Name, sizeof(lineData.Name), "%t", lineData.Name);
+    FormatEx(lineData.LevelInfo, sizeof(lineData.LevelInfo), "%t", "level", lineData.Level);
+    FormatEx(lineData.LimitInfo, sizeof(lineData.LimitInfo), "%t", "limit", lineData.Limit);
+    FormatEx(lineData.OnlineInfo, sizeof(lineData.OnlineInfo), "%t", "online", lineData.Online);
+    
+    // Validate cost
+    if(lineData.Cost) 
+    {
+        FormatEx(lineData.Price, sizeof(lineData.Price), "%t", "price", lineData.Cost, "money");
+    }
+    else
+    {
+        lineData.Price[0] = '\0';
+    }
+}
+
 /**
  * @brief Called when client selects option in the shop menu, and handles it.
  *  